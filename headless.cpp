@@ -0,0 +1,26 @@
+#include "src/setup/Headless.hpp"
+#include <cassert>
+#include <cstdlib>
+#include <string_view>
+
+// usage: fornani_headless [room_id] [num_ticks]
+//        fornani_headless --replay <file>
+//        fornani_headless --compare [room_id] [seconds]
+int main(int argc, char** argv) {
+	assert(argc > 0);
+	if (argc > 1 && std::string_view{argv[1]} == "--compare") {
+		fornani::Headless headless{argv};
+		headless.compare(argc > 2 ? std::atoi(argv[2]) : 100, argc > 3 ? static_cast<float>(std::atof(argv[3])) : 10.f);
+		return 0;
+	}
+	if (argc > 2 && std::string_view{argv[1]} == "--replay") {
+		fornani::Headless headless{argv};
+		headless.replay(argv[2]);
+		return 0;
+	}
+	auto room_id = argc > 1 ? std::atoi(argv[1]) : 100;
+	auto num_ticks = argc > 2 ? std::atoi(argv[2]) : 10000;
+	fornani::Headless headless{argv};
+	headless.run(room_id, num_ticks);
+	return 0;
+}
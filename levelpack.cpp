@@ -0,0 +1,26 @@
+#include "src/setup/LevelPack.hpp"
+#include "src/setup/ResourceFinder.hpp"
+#include <djson/json.hpp>
+#include <cassert>
+#include <iostream>
+
+// usage: fornani_levelpack [resource_dir]
+// packs every room in data/level/map_table.json into level/rooms.pack. rerun after editing a room;
+// until then the game loads that room from its json.
+int main(int argc, char** argv) {
+	assert(argc > 0);
+	auto finder = data::ResourceFinder{};
+	auto const resources = argc > 1 ? std::filesystem::path{argv[1]} : finder.find_resources(argv[0]);
+	auto const map_table = dj::Json::from_file((resources / "data/level/map_table.json").string().c_str());
+	if (map_table.is_null()) {
+		std::cerr << "no map table under " << resources << "\n";
+		return 1;
+	}
+	auto labels = std::vector<std::string>{};
+	for (auto const& room : map_table["rooms"].array_view()) { labels.push_back(room["label"].as_string()); }
+	auto const out = resources / "level" / data::LevelPack::filename;
+	auto const packed = data::LevelPack::compile(resources / "level", labels, out);
+	std::cout << "packed " << packed << " of " << labels.size() << " rooms into " << out.string() << "\n";
+	// rooms without both json files are skipped on purpose, so only a pack that couldn't be written fails the build
+	return packed > 0 || labels.empty() ? 0 : 1;
+}
@@ -6,5 +6,6 @@ int main(int argc, char** argv) {
 	game.run();
 	//for demo testing
 	//game.run(true, 200, "OVERTURNED_CANOPY_01", {100, 100});
+	//to capture a replay for fornani_headless --replay, call game.record_input("session.fnrp") before a demo run
 	return 0;
 }
@@ -21,10 +21,6 @@ void Option::update(ServiceProvider& svc, int& selection) {
 	label.setOrigin(label.getLocalBounds().width * 0.5f, label.getLocalBounds().height * 0.5f);
 }
 GameState::GameState(ServiceProvider& svc, player::Player& player, std::string_view scene, int id) : player(&player), hud(svc, player, {20, 20}), inventory_window(svc), pause_window(svc), scene(scene) {
-	font.loadFromFile(svc.text.title_font);
-	font.setSmooth(false);
-	subtitle_font.loadFromFile(svc.text.text_font);
-	subtitle_font.setSmooth(false);
 	auto const& in_data = svc.data.menu["options"];
 	for (auto& entry : in_data[scene].array_view()) {
 		options.push_back(Option(svc, entry.as_string()));
@@ -33,7 +29,7 @@ GameState::GameState(ServiceProvider& svc, player::Player& player, std::string_v
 	int ctr{};
 	for (auto& option : options) {
 		option.position = {svc.constants.screen_dimensions.x * 0.5f - option.label.getLocalBounds().width, top_buffer + ctr * (option.label.getLocalBounds().height + spacing)};
-		option.label.setFont(font);
+		option.label.setFont(svc.text.fonts.title);
 		option.index = ctr;
 		option.update(svc, current_selection);
 		++ctr;
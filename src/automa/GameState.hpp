@@ -15,6 +15,7 @@
 #include "../level/Map.hpp"
 #include "../gui/InventoryWindow.hpp"
 #include "../gui/PauseWindow.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace player {
 class Player;
@@ -72,10 +73,12 @@ class GameState {
 	virtual ~GameState() {}
 
 	virtual void init(ServiceProvider& svc, int room_number, std::string room_name = ""){};
+	// resets the state in place instead of rebuilding it. returns false if the state has to be rebuilt.
+	virtual bool restore(ServiceProvider& svc, int room_number) { return false; }
 	virtual void handle_events(ServiceProvider& svc, sf::Event& event){};
 	virtual void tick_update(ServiceProvider& svc){};
 	virtual void frame_update(ServiceProvider& svc){};
-	virtual void render(ServiceProvider& svc, sf::RenderWindow& win){};
+	virtual void render(ServiceProvider& svc, flfx::DrawList& win){};
 	void constrain_selection();
 
 	bool debug_mode{false};
@@ -92,8 +95,6 @@ class GameState {
 
 	player::Player* player;
 	gui::HUD hud;
-	sf::Font font{};
-	sf::Font subtitle_font{};
 
 	Scene target_folder{};
 	std::vector<Option> options{};
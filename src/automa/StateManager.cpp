@@ -30,13 +30,21 @@ void StateManager::process_state(ServiceProvider& svc, player::Player& player, f
 		}
 		svc.state_controller.actions.reset(Actions::exit_submenu);
 	}
+	auto restored{false};
 	if (svc.state_controller.actions.test(Actions::player_death)) {
 		if (svc.demo_mode()) {
 			svc.state_controller.next_state = svc.state_controller.demo_level;
 		} else {
 			if (svc.state_controller.actions.test(Actions::retry)) {
 				svc.state_controller.next_state = svc.state_controller.save_point_id;
-				svc.data.load_progress(player, svc.data.current_save, false, false);
+				// the snapshot taken at the last save point holds the same state as the save file, without parsing it
+				auto& snapshot = svc.snapshots.save_point;
+				if (snapshot.get_file() == svc.data.current_save && snapshot.get_room() == svc.state_controller.save_point_id) {
+					snapshot.restore(svc, player);
+					restored = true;
+				} else {
+					svc.data.load_progress(player, svc.data.current_save, false, false);
+				}
 				svc.state_controller.actions.reset(Actions::retry);
 				player.animation.state = player::AnimState::idle;
 				player.animation.triggers.reset(player::AnimTriggers::end_death);
@@ -63,8 +71,10 @@ void StateManager::process_state(ServiceProvider& svc, player::Player& player, f
 			set_current_state(std::make_unique<Intro>(svc, player, "intro"));
 		} else {
 			game.flags.set(fornani::GameFlags::in_game);
-			set_current_state(std::make_unique<Dojo>(svc, player, "dojo"));
-			get_current_state().init(svc, svc.state_controller.next_state);
+			if (!restored || !get_current_state().restore(svc, svc.state_controller.next_state)) {
+				set_current_state(std::make_unique<Dojo>(svc, player, "dojo"));
+				get_current_state().init(svc, svc.state_controller.next_state);
+			}
 			if (svc.demo_mode()) { player.set_position(svc.state_controller.player_position); }
 			game.playtest_sync();
 		}
@@ -73,6 +83,8 @@ void StateManager::process_state(ServiceProvider& svc, player::Player& player, f
 
 void StateManager::return_to_main_menu(ServiceProvider& svc, player::Player& player) {
 	set_current_state(std::make_unique<MainMenu>(svc, player, "main"));
+	svc.snapshots.save_point.clear();
+	svc.snapshots.room_entry.clear();
 	svc.state_controller.actions.reset(Actions::player_death);
 	svc.state_controller.actions.reset(Actions::trigger);
 	svc.state_controller.actions.reset(Actions::retry);
@@ -13,13 +13,13 @@ ControlsMenu::ControlsMenu(ServiceProvider& svc, player::Player& player, std::st
 		option.right_offset = option.position + sf::Vector2<float>{option.label.getLocalBounds().width + option.dot_offset.x, option.dot_offset.y};
 		option.label.setLetterSpacing(title_letter_spacing);
 		control_list.push_back(sf::Text());
-		control_list.back().setFont(font);
+		control_list.back().setFont(svc.text.fonts.title);
 		control_list.back().setLetterSpacing(title_letter_spacing);
 		++ctr;
 	}
 	refresh_controls(svc);
 	instruction.setLineSpacing(1.5f);
-	instruction.setFont(font);
+	instruction.setFont(svc.text.fonts.title);
 	instruction.setLetterSpacing(title_letter_spacing);
 	instruction.setCharacterSize(options.at(current_selection).label.getCharacterSize());
 	instruction.setPosition(svc.constants.screen_dimensions.x * 0.5f - instruction.getLocalBounds().width * 0.5f, svc.constants.screen_dimensions.y - 120.f);
@@ -112,7 +112,7 @@ void ControlsMenu::tick_update(ServiceProvider& svc) {
 
 void ControlsMenu::frame_update(ServiceProvider& svc) {}
 
-void ControlsMenu::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void ControlsMenu::render(ServiceProvider& svc, flfx::DrawList& win) {
 
 	if (loading.is_complete()) {
 		for (auto& option : options) { win.draw(option.label); }
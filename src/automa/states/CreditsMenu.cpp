@@ -54,7 +54,7 @@ void CreditsMenu::tick_update(ServiceProvider& svc) {
 
 void CreditsMenu::frame_update(ServiceProvider& svc) {}
 
-void CreditsMenu::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void CreditsMenu::render(ServiceProvider& svc, flfx::DrawList& win) {
 
 	for (auto& option : options) { win.draw(option.label); }
 
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "../GameState.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 
@@ -13,7 +14,7 @@ class CreditsMenu : public automa::GameState {
 	void handle_events(ServiceProvider& svc, sf::Event& event);
 	void tick_update(ServiceProvider& svc);
 	void frame_update(ServiceProvider& svc);
-	void render(ServiceProvider& svc, sf::RenderWindow& win);
+	void render(ServiceProvider& svc, flfx::DrawList& win);
 
 	
 };
@@ -4,7 +4,7 @@
 
 namespace automa {
 
-Dojo::Dojo(ServiceProvider& svc, player::Player& player, std::string_view scene, int id) : GameState(svc, player, scene, id), map(svc, player, console), gui_map(svc, player, console) {}
+Dojo::Dojo(ServiceProvider& svc, player::Player& player, std::string_view scene, int id) : GameState(svc, player, scene, id), map(svc, player, console) {}
 
 void Dojo::init(ServiceProvider& svc, int room_number, std::string room_name) {
 	//std::cout << "\n" << room_number;
@@ -27,6 +27,7 @@ void Dojo::init(ServiceProvider& svc, int room_number, std::string room_name) {
 		//std::cout << "Loading New Room...\n";
 	}
 	map.load(svc, room_number);
+	svc.data.room_cache.prefetch_neighbours(map.room_id);
 	bake_maps(svc, {map.room_id}, true);
 	auto m_id = map.room_id;
 	bake_maps(svc, svc.data.rooms);
@@ -63,6 +64,27 @@ void Dojo::init(ServiceProvider& svc, int room_number, std::string room_name) {
 	if (!player->is_dead()) { svc.state_controller.actions.reset(Actions::player_death); }
 
 	player->controller.prevent_movement();
+	svc.snapshots.room_entry.capture(svc, *player, map.room_id);
+}
+
+// only the room that is already loaded can be restored; the player has been placed by whoever restored the world state
+bool Dojo::restore(ServiceProvider& svc, int room_number) {
+	if (map.room_id != room_number) { return false; }
+	console = gui::Console(svc);
+	player->reset_flags();
+	map.restore(svc);
+	if (player->has_shield()) { hud.flags.set(gui::HUDState::shield); }
+	hud.set_corner_pad(svc, false);
+	svc.soundboard.turn_on();
+	player->collider.physics.zero();
+	camera.force_center(player->anchor_point);
+	enter_room.cancel();
+
+	svc.state_controller.actions.reset(Actions::save_loaded);
+	if (!player->is_dead()) { svc.state_controller.actions.reset(Actions::player_death); }
+
+	player->controller.prevent_movement();
+	return true;
 }
 
 void Dojo::handle_events(ServiceProvider& svc, sf::Event& event) {
@@ -131,15 +153,16 @@ void Dojo::frame_update(ServiceProvider& svc) {
 	pause_window.clean_off_trigger();
 }
 
-void Dojo::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void Dojo::render(ServiceProvider& svc, flfx::DrawList& win) {
 
 	//B.physics.position = sf::Vector2<float>(sf::Mouse::getPosition());
 
-	map.render_background(svc, win, camera.get_position());
-	map.render(svc, win, camera.get_position());
+	auto const campos = camera.get_interpolated_position(svc.ticker.get_alpha());
+	map.render_background(svc, win, campos);
+	map.render(svc, win, campos);
 
 	if (!svc.greyblock_mode()) { hud.render(*player, win); }
-	inventory_window.render(svc, *player, win, camera.get_position());
+	inventory_window.render(svc, *player, win, campos);
 	pause_window.render(svc, *player, win);
 	map.transition.render(win);
 	map.render_console(svc, console, win);
@@ -177,11 +200,11 @@ void Dojo::toggle_pause_menu(ServiceProvider& svc) {
 }
 
 void Dojo::bake_maps(ServiceProvider& svc, std::vector<int> ids, bool current) {
+	if (svc.headless()) { return; } // the minimap is only ever drawn
 	for (auto& id : ids) {
 		if (id == 0) { continue; } //intro
-		gui_map.clear();
-		if (svc.data.room_discovered(id)) { inventory_window.minimap.bake(svc, gui_map, id, current); } else {
-			inventory_window.minimap.bake(svc, gui_map, id, current, true);
+		if (svc.data.room_discovered(id)) { inventory_window.minimap.bake(svc, id, current); } else {
+			inventory_window.minimap.bake(svc, id, current, true);
 		}
 	}
 }
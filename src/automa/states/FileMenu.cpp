@@ -105,7 +105,7 @@ void FileMenu::tick_update(ServiceProvider& svc) {
 
 void FileMenu::frame_update(ServiceProvider& svc) {}
 
-void FileMenu::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void FileMenu::render(ServiceProvider& svc, flfx::DrawList& win) {
 	win.draw(title);
 	for (auto& option : options) { win.draw(option.label); }
 	player->render(svc, win, {});
@@ -62,7 +62,7 @@ void Intro::frame_update(ServiceProvider& svc) {
 	pause_window.clean_off_trigger();
 }
 
-void Intro::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void Intro::render(ServiceProvider& svc, flfx::DrawList& win) {
 	win.draw(title);
 	pause_window.render(svc, *player, win);
 	//map.render_background(svc, win, {});
@@ -3,6 +3,7 @@
 
 #include "../GameState.hpp"
 #include "../../level/Camera.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 
@@ -14,7 +15,7 @@ class Intro : public GameState {
 	void handle_events(ServiceProvider& svc, sf::Event& event);
 	void tick_update(ServiceProvider& svc);
 	void frame_update(ServiceProvider& svc);
-	void render(ServiceProvider& svc, sf::RenderWindow& win);
+	void render(ServiceProvider& svc, flfx::DrawList& win);
 	void toggle_pause_menu(ServiceProvider& svc);
 
 	world::Map map;
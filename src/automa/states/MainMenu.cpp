@@ -17,14 +17,14 @@ MainMenu::MainMenu(ServiceProvider& svc, player::Player& player, std::string_vie
 
 	if (flags.test(GameStateFlags::playtest)) { subtitle.setString("Playtester Edition"); }
 	subtitle.setLineSpacing(1.5f);
-	subtitle.setFont(subtitle_font);
+	subtitle.setFont(svc.text.fonts.text);
 	subtitle.setLetterSpacing(1.2f);
 	subtitle.setCharacterSize(options.at(current_selection).label.getCharacterSize());
 	subtitle.setPosition(svc.constants.screen_dimensions.x * 0.5f - subtitle.getLocalBounds().width * 0.5f, svc.constants.screen_dimensions.y - 324.f);
 	subtitle.setFillColor(svc.styles.colors.red);
 	if (flags.test(GameStateFlags::playtest)) { instruction.setString("press [P] to open playtester portal"); }
 	instruction.setLineSpacing(1.5f);
-	instruction.setFont(subtitle_font);
+	instruction.setFont(svc.text.fonts.text);
 	instruction.setLetterSpacing(1.2f);
 	instruction.setCharacterSize(options.at(current_selection).label.getCharacterSize());
 	instruction.setPosition(svc.constants.screen_dimensions.x * 0.5f - instruction.getLocalBounds().width * 0.5f, svc.constants.screen_dimensions.y - 36.f);
@@ -97,7 +97,7 @@ void MainMenu::tick_update(ServiceProvider& svc) {
 
 void MainMenu::frame_update(ServiceProvider& svc) {}
 
-void MainMenu::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void MainMenu::render(ServiceProvider& svc, flfx::DrawList& win) {
 	win.draw(title);
 	win.draw(subtitle);
 	//win.draw(instruction);
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "../GameState.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 
@@ -17,7 +18,7 @@ class MainMenu : public GameState {
 	void handle_events(ServiceProvider& svc, sf::Event& event);
 	void tick_update(ServiceProvider& svc);
 	void frame_update(ServiceProvider& svc);
-	void render(ServiceProvider& svc, sf::RenderWindow& win);
+	void render(ServiceProvider& svc, flfx::DrawList& win);
 
 	sf::Sprite title{};
 	sf::Text subtitle{};
@@ -77,7 +77,7 @@ void OptionsMenu::tick_update(ServiceProvider& svc) {
 
 void OptionsMenu::frame_update(ServiceProvider& svc) {}
 
-void OptionsMenu::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void OptionsMenu::render(ServiceProvider& svc, flfx::DrawList& win) {
 	
 	for (auto& option : options) { win.draw(option.label); }
 
@@ -14,9 +14,7 @@ StatSheet::StatSheet(ServiceProvider& svc, player::Player& player, std::string_v
 							 "\nrooms discovered: " + std::to_string(svc.data.discovered_rooms.size()) + " / 25\nguns collected: " + std::to_string(player.arsenal_size()) +
 							 " / 2\n items found: " + std::to_string(player.catalog.categories.inventory.items.size()) + " / 9\n'get bryn's gun' speedrun time: " + std::to_string(svc.stats.time_trials.bryns_gun) + " seconds";
 	stats.setString(statistics);
-	stat_font.loadFromFile(svc.text.text_font);
-	stat_font.setSmooth(false);
-	stats.setFont(stat_font);
+	stats.setFont(svc.text.fonts.text);
 	stats.setLineSpacing(2.0f);
 	svc.music.load("firstwind");
 	svc.music.play_looped(10);
@@ -70,7 +68,7 @@ void StatSheet::tick_update(ServiceProvider& svc) {
 
 void StatSheet::frame_update(ServiceProvider& svc) {}
 
-void StatSheet::render(ServiceProvider& svc, sf::RenderWindow& win) {
+void StatSheet::render(ServiceProvider& svc, flfx::DrawList& win) {
 
 	for (auto& option : options) { win.draw(option.label); }
 	win.draw(stats);
@@ -21,7 +21,7 @@ CircleSensor::CircleSensor(float radius) {
 	drawable = bounds;
 }
 
-void CircleSensor::render(sf::RenderWindow& win, sf::Vector2<float> cam) {
+void CircleSensor::render(flfx::DrawList& win, sf::Vector2<float> cam) {
 	drawable = bounds;
 	drawable.setFillColor(active() ? sf::Color{20, 160, 160, 100} : sf::Color::Transparent);
 	drawable.setPosition(bounds.getPosition() - cam);
@@ -4,6 +4,7 @@
 #include <SFML/Graphics.hpp>
 #include "../utils/Shape.hpp"
 #include "../utils/BitFlags.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace components {
 enum class SensorState { active };
@@ -11,7 +12,7 @@ class CircleSensor {
   public:
 	CircleSensor();
 	CircleSensor(float radius);
-	void render(sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(flfx::DrawList& win, sf::Vector2<float> cam);
 	sf::CircleShape bounds{};
 	sf::CircleShape drawable{};
 	bool within_bounds(shape::Shape& rect) const;
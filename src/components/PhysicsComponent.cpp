@@ -34,17 +34,9 @@ void PhysicsComponent::integrate(automa::ServiceProvider& svc) {
 	velocity.y = std::clamp(velocity.y, -maximum_velocity.y, maximum_velocity.y);
 	position = position + velocity * dt;
 
-	if (y_acc_history.size() < acceleration_sample_size) { y_acc_history.push_back(acceleration.y);
-	} else {
-		y_acc_history.pop_front();
-		y_acc_history.push_back(acceleration.y);
-	}
-	if (x_acc_history.size() < acceleration_sample_size) {
-		x_acc_history.push_back(acceleration.x);
-	} else {
-		x_acc_history.pop_front();
-		x_acc_history.push_back(acceleration.x);
-	}
+	if (!tracking_statistics()) { return; }
+	acceleration_statistics.x.push(acceleration.x);
+	acceleration_statistics.y.push(acceleration.y);
 
 	calculate_maximum_acceleration();
 	calculate_jerk();
@@ -58,26 +50,25 @@ void PhysicsComponent::update_dampen(automa::ServiceProvider& svc) {
 }
 
 void PhysicsComponent::calculate_maximum_acceleration() {
-	auto max = acceleration.x;
-	for (auto& acc : x_acc_history) {
-		if (acc > max) { max = acc; }
-	}
+	maximum_acceleration.x = acceleration_statistics.x.maximum();
+	maximum_acceleration.y = acceleration_statistics.y.maximum();
 }
 
 void PhysicsComponent::calculate_jerk() {
-	float sum{};
-	float previous_y{acceleration.y};
-	for (auto& instance : y_acc_history) {
-		sum += instance - previous_y;
-		previous_y = instance;
-	}
-	jerk.y = sum / acceleration_sample_size;
-	float previous_x{acceleration.x};
-	for (auto& instance : x_acc_history) {
-		sum += instance - previous_x;
-		previous_x = instance;
-	}
-	jerk.x = sum / acceleration_sample_size;
+	jerk.x = acceleration_statistics.x.average_delta();
+	jerk.y = acceleration_statistics.y.average_delta();
+}
+
+void PhysicsComponent::enable_statistics(int sample_size) {
+	acceleration_statistics.x.enable(static_cast<std::size_t>(sample_size));
+	acceleration_statistics.y.enable(static_cast<std::size_t>(sample_size));
+}
+
+void PhysicsComponent::disable_statistics() {
+	acceleration_statistics.x.disable();
+	acceleration_statistics.y.disable();
+	maximum_acceleration = {};
+	jerk = {};
 }
 
 void PhysicsComponent::zero() {
@@ -6,9 +6,9 @@
 #include <cmath>
 #include <random>
 #include <vector>
-#include <deque>
 #include "../utils/BitFlags.hpp"
 #include "../utils/Direction.hpp"
+#include "../utils/WindowedStatistics.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -58,6 +58,8 @@ class PhysicsComponent {
 	void update_dampen(automa::ServiceProvider& svc);
 	void calculate_maximum_acceleration();
 	void calculate_jerk();
+	void enable_statistics(int sample_size = default_sample_size);
+	void disable_statistics();
 	void zero();
 	void zero_x();
 	void zero_y();
@@ -68,13 +70,18 @@ class PhysicsComponent {
 	[[nodiscard]] auto apparent_acceleration() const -> sf::Vector2<float> { return apparent_velocity() - previous_velocity; }
 	[[nodiscard]] auto elastic_collision() const -> bool { return velocity.x * previous_velocity.x < elastic_threshold || velocity.y * previous_velocity.y < elastic_threshold; }
 	[[nodiscard]] auto stationary() const -> bool { return abs(velocity.x) < epsilon && abs(velocity.y) < epsilon; }
+	[[nodiscard]] auto tracking_statistics() const -> bool { return acceleration_statistics.x.enabled(); }
 
 	util::BitFlags<State> flags{};
 	dir::Direction direction{};
 
-	std::deque<float> x_acc_history{};
-	std::deque<float> y_acc_history{};
-	int acceleration_sample_size{2560};
+	// opt-in; only bodies that call enable_statistics() pay for jerk and max acceleration tracking
+	struct {
+		util::WindowedStatistics x{};
+		util::WindowedStatistics y{};
+	} acceleration_statistics{};
+	sf::Vector2<float> maximum_acceleration{};
+	static constexpr int default_sample_size{2560};
 	float epsilon{0.0001f};
 };
 
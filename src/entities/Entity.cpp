@@ -23,8 +23,8 @@ void Entity::sprite_flip() {
 void Entity::sprite_shake(automa::ServiceProvider& svc, int rate, int energy) {
 	if (svc.ticker.every_x_ticks(rate)) {
 		auto f_energy = static_cast<float>(energy);
-		auto randx = svc.random.random_range_float(-f_energy, f_energy);
-		auto randy = svc.random.random_range_float(-f_energy, f_energy);
+		auto randx = svc.random.vfx.random_range_float(-f_energy, f_energy);
+		auto randy = svc.random.vfx.random_range_float(-f_energy, f_energy);
 		random_offset = sf::Vector2<float>{randx, randy};
 	}
 }
@@ -5,6 +5,7 @@
 #include "../utils/Direction.hpp"
 #include "../utils/BitFlags.hpp"
 #include <iostream>
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -24,7 +25,7 @@ class Entity {
 	virtual ~Entity() {};
 	Entity(automa::ServiceProvider& svc){};
 	virtual void update(automa::ServiceProvider& svc, world::Map& map);
-	virtual void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) = 0;
+	virtual void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) = 0;
 	void sprite_flip();
 	void sprite_shake(automa::ServiceProvider& svc, int rate = 16, int energy = 4);
 	[[nodiscard]] auto get_direction() const -> dir::Direction { return direction; }
@@ -33,7 +33,7 @@ void AnimatedSprite::set_origin(sf::Vector2<float> origin) { sprite.setOrigin(or
 
 void AnimatedSprite::end() { animation.end(); }
 
-void AnimatedSprite::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void AnimatedSprite::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (!svc.greyblock_mode()) {
 		sprite.setPosition(position - cam);
 		win.draw(sprite);
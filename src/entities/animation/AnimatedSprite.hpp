@@ -10,6 +10,7 @@
 #include "../../utils/BitFlags.hpp"
 #include "../../utils/Cooldown.hpp"
 #include "../../utils/Counter.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -27,7 +28,7 @@ class AnimatedSprite {
 	void set_dimensions(sf::Vector2<int> dim);
 	void set_origin(sf::Vector2<float> origin);
 	void end();
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	[[nodiscard]] auto get_frame() const -> int { return animation.get_frame(); }
 	[[nodiscard]] auto just_started() const -> bool { return animation.just_started(); }
 	[[nodiscard]] auto complete() -> bool { return animation.complete(); }
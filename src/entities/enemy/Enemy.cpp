@@ -115,23 +115,9 @@ void Enemy::update(automa::ServiceProvider& svc, world::Map& map, player::Player
 		return;
 	}
 	Entity::update(svc, map);
-	collider.update(svc);
-	secondary_collider.update(svc);
+	integrate(svc, map);
 	health_indicator.update(svc, collider.physics.position);
 
-	if (flags.general.test(GeneralFlags::map_collision)) {
-		for (auto& breakable : map.breakables) { breakable.handle_collision(collider); }
-		collider.detect_map_collision(map);
-		secondary_collider.detect_map_collision(map);
-	}
-	collider.reset();
-	secondary_collider.reset();
-	if (collider.collision_depths) { collider.collision_depths.value().update(); }
-	collider.reset_ground_flags();
-	secondary_collider.reset_ground_flags();
-	collider.physics.acceleration = {};
-	secondary_collider.physics.acceleration = {};
-
 	animation.update();
 	health.update();
 
@@ -160,13 +146,39 @@ void Enemy::update(automa::ServiceProvider& svc, world::Map& map, player::Player
 	sprite.setOrigin((float)sprite_dimensions.x / 2.f, (float)dimensions.y / 2.f);
 }
 
+// moves the body and resolves it against the map, without any behaviour. update runs this every tick,
+// and the map calls it alone on the ticks a reduced chunk skips, so distant enemies still fall and slide at full rate.
+void Enemy::integrate(automa::ServiceProvider& svc, world::Map& map) {
+	if (died() && !flags.general.test(GeneralFlags::post_death_render)) { return; }
+	// corpses that have come to rest stop simulating until something disturbs them
+	if (died() && collider.asleep() && (map.is_disturbed(collider) || collider.physics.acceleration != sf::Vector2<float>{})) { collider.wake(); }
+	if (died() && collider.asleep()) { return; }
+	collider.update(svc);
+	secondary_collider.update(svc);
+
+	if (flags.general.test(GeneralFlags::map_collision)) {
+		for (auto& breakable : map.breakables) { breakable.handle_collision(collider); }
+		collider.detect_map_collision(map);
+		secondary_collider.detect_map_collision(map);
+	}
+	if (died()) { collider.settle(); }
+	collider.reset();
+	secondary_collider.reset();
+	if (collider.collision_depths) { collider.collision_depths.value().update(); }
+	collider.reset_ground_flags();
+	secondary_collider.reset_ground_flags();
+	collider.physics.acceleration = {};
+	secondary_collider.physics.acceleration = {};
+}
+
 void Enemy::post_update(automa::ServiceProvider& svc, world::Map& map, player::Player& player) { handle_player_collision(player); }
 
-void Enemy::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Enemy::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (died() && !flags.general.test(GeneralFlags::post_death_render)) { return; }
+	auto const position = collider.get_interpolated_position(svc.ticker.get_alpha());
 	drawbox.setOrigin(sprite.getOrigin());
-	drawbox.setPosition(collider.physics.position + sprite_offset - cam);
-	sprite.setPosition(collider.physics.position + sprite_offset - cam + random_offset);
+	drawbox.setPosition(position + sprite_offset - cam);
+	sprite.setPosition(position + sprite_offset - cam + random_offset);
 	if (!flags.state.test(StateFlags::shaking)) { random_offset = {}; }
 	if (svc.greyblock_mode()) {
 		win.draw(sprite);
@@ -191,7 +203,7 @@ void Enemy::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vect
 	}
 }
 
-void Enemy::render_indicators(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) { health_indicator.render(svc, win, cam); }
+void Enemy::render_indicators(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) { health_indicator.render(svc, win, cam); }
 
 void Enemy::handle_player_collision(player::Player& player) const {
 	if (died()) { return; }
@@ -13,6 +13,7 @@
 #include "../player/Indicator.hpp"
 #include <string_view>
 #include <iostream>
+#include "../../graphics/DrawList.hpp"
 
 namespace player {
 class Player;
@@ -52,12 +53,13 @@ class Enemy : public entity::Entity {
 	virtual ~Enemy() {}
 	Enemy(automa::ServiceProvider& svc, std::string_view label, bool spawned = false);
 	void update(automa::ServiceProvider& svc, world::Map& map, player::Player& player);
+	void integrate(automa::ServiceProvider& svc, world::Map& map);
 	void post_update(automa::ServiceProvider& svc, world::Map& map, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) override;
-	void render_indicators(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) override;
+	void render_indicators(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	virtual void unique_update(automa::ServiceProvider& svc, world::Map& map, player::Player& player){};
-	virtual void unique_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam){};
-	virtual void gui_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam){};
+	virtual void unique_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam){};
+	virtual void gui_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam){};
 	void handle_player_collision(player::Player& player) const;
 	void on_hit(automa::ServiceProvider& svc, world::Map& map, arms::Projectile& proj);
 	void on_crush(world::Map& map);
@@ -78,8 +80,7 @@ class Enemy : public entity::Entity {
 	[[nodiscard]] auto is_transcendent() const -> bool { return flags.general.test(GeneralFlags::transcendent); }
 	[[nodiscard]] bool player_behind(player::Player& player) const;
 	void set_position(sf::Vector2<float> pos) {
-		collider.physics.position = pos;
-		collider.sync_components();
+		collider.set_position(pos);
 		health_indicator.set_position(pos);
 	}
 	void hurt() { flags.state.set(StateFlags::hurt); }
@@ -192,11 +192,16 @@ void Minigus::unique_update(automa::ServiceProvider& svc, world::Map& map, playe
 			}
 		}
 	}
-		for (auto& breakable : map.breakables) {
+		map.broadphase.query_aabb(Enemy::collider.jumpbox, world::Body::breakable, [this, &svc, &map](std::size_t index) {
+			auto& breakable = map.breakables.at(index);
 			if (Enemy::collider.jumpbox.overlaps(breakable.get_bounding_box())) { breakable.on_smash(svc, map, 4); }
-			if (state == MinigusState::rush && attacks.rush.hit.within_bounds(breakable.get_bounding_box())) {
-				if (svc.ticker.every_x_ticks(18)) { breakable.on_smash(svc, map, 1); }
-			}
+		});
+		if (state == MinigusState::rush) {
+			auto const& hit = attacks.rush.hit.bounds;
+			map.broadphase.query_circle(hit.getPosition(), hit.getRadius(), world::Body::breakable, [this, &svc, &map](std::size_t index) {
+				auto& breakable = map.breakables.at(index);
+				if (attacks.rush.hit.within_bounds(breakable.get_bounding_box()) && svc.ticker.every_x_ticks(18)) { breakable.on_smash(svc, map, 1); }
+			});
 		}
 	
 
@@ -294,8 +299,8 @@ void Minigus::unique_update(automa::ServiceProvider& svc, world::Map& map, playe
 	if (!status.test(MinigusFlags::second_phase) && half_health()) { state = MinigusState::struggle; }
 
 	if (half_health()) {
-		auto pos = secondary_collider.physics.position + svc.random.random_vector_float(10.f, 40.f);
-		if (svc.ticker.every_x_ticks(10) && svc.random.percent_chance(5)) { map.effects.push_back(entity::Effect(svc, pos, {0.f, 4.f}, 3, 7)); }
+		auto pos = secondary_collider.physics.position + svc.random.vfx.random_vector_float(10.f, 40.f);
+		if (svc.ticker.every_x_ticks(10) && svc.random.vfx.percent_chance(5)) { map.effects.push_back(entity::Effect(svc, pos, {0.f, 4.f}, 3, 7)); }
 	}
 
 	// NPC stuff
@@ -330,7 +335,7 @@ void Minigus::unique_update(automa::ServiceProvider& svc, world::Map& map, playe
 	state_function = state_function();
 }
 
-void Minigus::unique_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Minigus::unique_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	NPC::render(svc, win, cam);
 	auto u = minigun.animation.get_frame() >= 13 ? 78 : 0;
 	auto v = (minigun.animation.get_frame() % 13) * 30;
@@ -362,7 +367,7 @@ void Minigus::unique_render(automa::ServiceProvider& svc, sf::RenderWindow& win,
 	}
 }
 
-void Minigus::gui_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Minigus::gui_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (status.test(MinigusFlags::battle_mode)) { health_bar.render(win); }
 }
 
@@ -823,7 +828,7 @@ fsm::StateFunction Minigus::update_struggle() {
 	minigun.animation.set_params(minigun.neutral);
 	minigun.state = MinigunState::neutral;
 	// always do
-	sf::Vector2<float> pos = secondary_collider.physics.position + m_services->random.random_vector_float(0.f, 50.f);
+	sf::Vector2<float> pos = secondary_collider.physics.position + m_services->random.vfx.random_vector_float(0.f, 50.f);
 	if (m_services->ticker.every_x_ticks(80)) { m_map->effects.push_back(entity::Effect(*m_services, pos, {}, 3, 0)); }
 	Enemy::shake();
 	Enemy::sprite_shake(*m_services, 20, 8);
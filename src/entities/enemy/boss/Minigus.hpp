@@ -5,6 +5,7 @@
 #include "../../../components/CircleSensor.hpp"
 #include "../../../gui/StatusBar.hpp"
 #include "../../../graphics/SpriteHistory.hpp"
+#include "../../../graphics/DrawList.hpp"
 #define MINIGUS_BIND(f) std::bind(&Minigus::f, this)
 
 namespace enemy {
@@ -21,8 +22,8 @@ class Minigus : public Enemy, public npc::NPC {
 	~Minigus() override {}
 	Minigus(automa::ServiceProvider& svc, world::Map& map, gui::Console& console);
 	void unique_update(automa::ServiceProvider& svc, world::Map& map, player::Player& player) override;
-	void unique_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) override;
-	void gui_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) override;
+	void unique_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) override;
+	void gui_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) override;
 	[[nodiscard]] auto invincible() const -> bool { return !flags.state.test(StateFlags::vulnerable); }
 	[[nodiscard]] auto half_health() const -> bool { return health.get_hp() < health.get_max() * 0.5f; }
 
@@ -16,6 +16,7 @@ void Eyebit::unique_update(automa::ServiceProvider& svc, world::Map& map, player
 		Enemy::update(svc, map, player);
 		return;
 	}
+	auto const start = collider.physics.position;
 	if (!seeker_cooldown.is_complete()) { seeker.set_position(collider.physics.position); }
 	seeker_cooldown.update();
 	flags.state.set(StateFlags::vulnerable); // eyebit is always vulnerable
@@ -37,6 +38,7 @@ void Eyebit::unique_update(automa::ServiceProvider& svc, world::Map& map, player
 	}
 
 	Enemy::update(svc, map, player);
+	collider.physics.previous_position = start; // the seeker moves the body before it integrates, so blend from where the tick began
 	seeker.set_position(collider.physics.position);
 }
 
@@ -112,7 +112,7 @@ void Thug::unique_update(automa::ServiceProvider& svc, world::Map& map, player::
 	state_function = state_function();
 }
 
-void Thug::unique_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Thug::unique_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (!svc.greyblock_mode()) {
 	} else {
 		if (state == ThugState::punch) { attacks.punch.render(win, cam); }
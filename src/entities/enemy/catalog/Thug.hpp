@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Enemy.hpp"
+#include "../../../graphics/DrawList.hpp"
 #define THUG_BIND(f) std::bind(&Thug::f, this)
 
 namespace enemy {
@@ -15,7 +16,7 @@ class Thug : public Enemy {
 		Thug& operator = (Thug&&) = delete;
 		Thug(automa::ServiceProvider& svc, world::Map& map);
 		void unique_update(automa::ServiceProvider& svc, world::Map& map, player::Player& player) override;
-		void unique_render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) override;
+		void unique_render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) override;
 
 		fsm::StateFunction state_function = std::bind(&Thug::update_idle, this);
 		fsm::StateFunction update_idle();
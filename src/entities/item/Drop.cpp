@@ -29,7 +29,7 @@ Drop::Drop(automa::ServiceProvider& svc, std::string_view key, float probability
 	animation.refresh();
 
 	// randomly seed the animation start frame so drops in the same loot animate out of sync
-	animation.frame.set(svc.random.random_range(0, animation.params.duration - 1));
+	animation.frame.set(svc.random.vfx.random_range(0, animation.params.duration - 1));
 
 	int rand_cooldown_offset = svc.random.random_range(0, 50);
 	lifespan.start(4500 + rand_cooldown_offset);
@@ -87,17 +87,23 @@ void Drop::set_texture(automa::ServiceProvider& svc) {
 
 void Drop::update(automa::ServiceProvider& svc, world::Map& map) {
 	delay.update();
-	collider.update(svc);
-	collider.detect_map_collision(map);
-	for (auto& breakable : map.breakables) { collider.handle_collider_collision(breakable.get_bounding_box()); }
-	for (auto& pushable : map.pushables) { collider.handle_collider_collision(pushable.get_bounding_box()); }
-	for (auto& platform : map.platforms) { collider.handle_collider_collision(platform.bounding_box); }
-	for (auto& block : map.switch_blocks) { collider.handle_collider_collision(block.get_bounding_box()); }
-	for (auto& destroyer : map.destroyers) { collider.handle_collider_collision(destroyer.get_bounding_box()); }
-	for (auto& spike : map.spikes) { collider.handle_collider_collision(spike.get_bounding_box()); }
-	collider.reset();
-	collider.reset_ground_flags();
-	collider.physics.acceleration = {};
+	// drops resting on the floor skip their physics until something could move them
+	if (collider.asleep() && (map.is_disturbed(collider) || collider.physics.acceleration != sf::Vector2<float>{})) { collider.wake(); }
+	if (!collider.asleep()) {
+		collider.update(svc);
+		collider.detect_map_collision(map);
+		auto& broadphase = map.broadphase;
+		broadphase.query_aabb(collider.vicinity, world::Body::breakable, [this, &map](std::size_t index) { collider.handle_collider_collision(map.breakables.at(index).get_bounding_box()); });
+		broadphase.query_aabb(collider.vicinity, world::Body::pushable, [this, &map](std::size_t index) { collider.handle_collider_collision(map.pushables.at(index).get_bounding_box()); });
+		broadphase.query_aabb(collider.vicinity, world::Body::platform, [this, &map](std::size_t index) { collider.handle_collider_collision(map.platforms.at(index).bounding_box); });
+		broadphase.query_aabb(collider.vicinity, world::Body::switch_block, [this, &map](std::size_t index) { collider.handle_collider_collision(map.switch_blocks.at(index).get_bounding_box()); });
+		broadphase.query_aabb(collider.vicinity, world::Body::destroyer, [this, &map](std::size_t index) { collider.handle_collider_collision(map.destroyers.at(index).get_bounding_box()); });
+		broadphase.query_aabb(collider.vicinity, world::Body::spike, [this, &map](std::size_t index) { collider.handle_collider_collision(map.spikes.at(index).get_bounding_box()); });
+		collider.settle();
+		collider.reset();
+		collider.reset_ground_flags();
+		collider.physics.acceleration = {};
+	}
 
 	lifespan.update();
 	afterlife.update();
@@ -123,11 +129,11 @@ void Drop::update(automa::ServiceProvider& svc, world::Map& map) {
 	}
 }
 
-void Drop::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos) {
+void Drop::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos) {
 	if (svc.greyblock_mode()) {
 		collider.render(win, campos);
 	} else {
-		sprite.setPosition(collider.physics.position + sprite_offset - campos);
+		sprite.setPosition(collider.get_interpolated_position(svc.ticker.get_alpha()) + sprite_offset - campos);
 		if (!is_inactive() && !is_completely_gone() && (lifespan.get_cooldown() > 500 || (lifespan.get_cooldown() / 20) % 2 == 0)) {
 			win.draw(sprite);
 		}
@@ -137,7 +143,7 @@ void Drop::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vecto
 }
 
 void Drop::set_position(sf::Vector2<float> pos) {
-	collider.physics.position = pos;
+	collider.set_position(pos);
 	sparkler.set_position(pos);
 }
 
@@ -7,6 +7,7 @@
 #include "../../utils/Cooldown.hpp"
 #include "../../particle/Sparkler.hpp"
 #include "../../graphics/FLColor.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -35,7 +36,7 @@ class Drop {
 	void set_value();
 	void set_texture(automa::ServiceProvider& svc);
 	void update(automa::ServiceProvider& svc, world::Map& map);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos);
 	void set_position(sf::Vector2<float> pos);
 
 	void destroy_completely();
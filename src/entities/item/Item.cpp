@@ -34,7 +34,7 @@ void Item::update(automa::ServiceProvider& svc, int index) {
 	selected() ? drawbox.setOutlineColor(svc.styles.colors.green) : drawbox.setOutlineColor(svc.styles.colors.blue);
 }
 
-void Item::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) { svc.greyblock_mode() ? win.draw(drawbox) : win.draw(sprite); }
+void Item::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) { svc.greyblock_mode() ? win.draw(drawbox) : win.draw(sprite); }
 
 void Item::add_item(int amount) { variables.quantity += amount; }
 
@@ -3,6 +3,7 @@
 #include <string_view>
 #include "../../utils/BitFlags.hpp"
 #include "../Entity.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -22,7 +23,7 @@ class Item : public entity::Entity {
 	Item() = default;
 	Item(automa::ServiceProvider& svc, std::string_view label);
 	void update(automa::ServiceProvider& svc, int index);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void add_item(int amount);
 	void set_id(int new_id);
 	void select();
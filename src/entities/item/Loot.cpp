@@ -48,10 +48,14 @@ void Loot::update(automa::ServiceProvider& svc, world::Map& map, player::Player&
 	}
 }
 
-void Loot::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos) {
+void Loot::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos) {
 	for (auto& drop : drops) { drop.render(svc, win, campos); }
 }
 
+void Loot::wake() {
+	for (auto& drop : drops) { drop.get_collider().wake(); }
+}
+
 void Loot::set_position(sf::Vector2<float> pos) { position = pos; }
 
 } // namespace item
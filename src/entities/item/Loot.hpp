@@ -4,6 +4,7 @@
 #include <string>
 #include "Drop.hpp"
 #include "../../utils/BitFlags.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -27,8 +28,9 @@ class Loot {
 	Loot(automa::ServiceProvider& svc, sf::Vector2<int> drop_range, float probability, sf::Vector2<float> pos, int delay_time = 0);
 
 	void update(automa::ServiceProvider& svc, world::Map& map, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos);
 	void set_position(sf::Vector2<float> pos);
+	void wake();
 
   private:
 	sf::Vector2<float> position{};
@@ -38,6 +38,14 @@ NPC::NPC(automa::ServiceProvider& svc, int id) : id(id), animation_machine(std::
 	direction.lr = dir::LR::left;
 }
 
+// the body alone. the map calls this on the ticks a reduced chunk skips, so distant npcs keep falling and sliding at full rate.
+void NPC::integrate(automa::ServiceProvider& svc, world::Map& map) {
+	collider.update(svc);
+	collider.detect_map_collision(map);
+	collider.reset();
+	collider.physics.acceleration = {};
+}
+
 void NPC::update(automa::ServiceProvider& svc, world::Map& map, gui::Console& console, player::Player& player) {
 	direction.lr = (player.collider.physics.position.x < collider.physics.position.x) ? dir::LR::left : dir::LR::right;
 	Entity::update(svc, map);
@@ -52,10 +60,7 @@ void NPC::update(automa::ServiceProvider& svc, world::Map& map, gui::Console& co
 
 	indicator.update(collider.physics.position);
 
-	collider.update(svc);
-	collider.detect_map_collision(map);
-	collider.reset();
-	collider.physics.acceleration = {};
+	integrate(svc, map);
 
 	console.active() ? state_flags.set(NPCState::talking) : state_flags.reset(NPCState::talking);
 	if (player.collider.bounding_box.overlaps(collider.bounding_box) || (triggers.test(NPCTrigger::distant_interact) && state_flags.test(NPCState::force_interact))) {
@@ -98,8 +103,9 @@ void NPC::update(automa::ServiceProvider& svc, world::Map& map, gui::Console& co
 	triggers = {};
 }
 
-void NPC::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos) {
-	sprite.setPosition(collider.physics.position.x - campos.x + sprite_offset.x, collider.physics.position.y - campos.y + sprite_offset.y);
+void NPC::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos) {
+	auto const position = collider.get_interpolated_position(svc.ticker.get_alpha());
+	sprite.setPosition(position - campos + sprite_offset);
 	if (spritesheet_dimensions.y > 0) {
 		int u = (int)(animation_machine->animation.get_frame() / spritesheet_dimensions.y) * sprite_dimensions.x;
 		int v = (int)(animation_machine->animation.get_frame() % spritesheet_dimensions.y) * sprite_dimensions.y;
@@ -108,7 +114,7 @@ void NPC::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector
 
 	if (svc.greyblock_mode()) {
 		collider.render(win, campos);
-		drawbox.setPosition(collider.physics.position - campos);
+		drawbox.setPosition(position - campos);
 		state_flags.test(NPCState::engaged) ? drawbox.setFillColor(svc.styles.colors.green) : drawbox.setFillColor(svc.styles.colors.dark_orange);
 		win.draw(drawbox);
 	} else {
@@ -117,9 +123,9 @@ void NPC::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector
 	indicator.render(svc, win, campos);
 }
 
-void NPC::set_position(sf::Vector2<float> pos) { collider.physics.position = pos; }
+void NPC::set_position(sf::Vector2<float> pos) { collider.set_position(pos); }
 
-void NPC::set_position_from_scaled(sf::Vector2<float> scaled_pos) { collider.physics.position = scaled_pos * 32.f; }
+void NPC::set_position_from_scaled(sf::Vector2<float> scaled_pos) { collider.set_position(scaled_pos * 32.f); }
 
 void NPC::set_id(int new_id) { id = new_id; }
 
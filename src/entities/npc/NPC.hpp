@@ -8,6 +8,7 @@
 #include "../animation/AnimatedSprite.hpp"
 #include <deque>
 #include <string_view>
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -34,7 +35,8 @@ class NPC : public entity::Entity {
   public:
 	NPC(automa::ServiceProvider& svc, int id);
 	void update(automa::ServiceProvider& svc, world::Map& map, gui::Console& console, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos);
+	void integrate(automa::ServiceProvider& svc, world::Map& map);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos);
 	void set_position(sf::Vector2<float> pos);
 	void set_position_from_scaled(sf::Vector2<float> scaled_pos);
 	void set_id(int new_id);
@@ -42,6 +44,7 @@ class NPC : public entity::Entity {
 	void flush_conversations();
 	void push_to_background() { state_flags.set(NPCState::background); }
 	[[nodiscard]] auto background() const -> bool { return state_flags.test(NPCState::background); }
+	[[nodiscard]] auto get_position() const -> sf::Vector2<float> { return collider.physics.position; }
 
 	std::string_view label{};
 
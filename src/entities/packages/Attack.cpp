@@ -23,7 +23,7 @@ void Attack::handle_player(player::Player& player) {
 	hit.within_bounds(player.collider.bounding_box) ? hit.activate() : hit.deactivate();
 }
 
-void Attack::render(sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Attack::render(flfx::DrawList& win, sf::Vector2<float> cam) {
 	sensor.render(win, cam);
 	hit.render(win, cam);
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "../../components/CircleSensor.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace player {
 class Player;
@@ -14,7 +15,7 @@ class Attack {
 	void update();
 	void set_position(sf::Vector2<float> position);
 	void handle_player(player::Player& player);
-	void render(sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(flfx::DrawList& win, sf::Vector2<float> cam);
 
 	components::CircleSensor sensor{};
 	components::CircleSensor hit{};
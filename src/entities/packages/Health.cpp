@@ -25,7 +25,7 @@ void Health::update() {
 	}
 }
 
-void Health::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Health::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	drawbox.setFillColor(svc.styles.colors.dark_orange);
 	drawbox.setSize({max_hp, 4});
 	win.draw(drawbox);
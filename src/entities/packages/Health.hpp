@@ -3,6 +3,7 @@
 #include "../Entity.hpp"
 #include "../../utils/Cooldown.hpp"
 #include "../../utils/Counter.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace entity {
 enum class HPState { hit };
@@ -10,7 +11,7 @@ class Health : public Entity {
 	float const default_max{8.f};
   public:
 	void update();
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	[[nodiscard]] auto get_hp() const -> float { return hp; }
 	[[nodiscard]] auto get_max() const -> float { return max_hp; }
 	[[nodiscard]] auto get_limit() const -> float { return hp_limit; }
@@ -33,6 +33,6 @@ void Shockwave::set_position(sf::Vector2<float> position) { hit.bounds.setPositi
 
 void Shockwave::handle_player(player::Player& player) { hit.within_bounds(player.collider.bounding_box) && lifetime.running() ? hit.activate() : hit.deactivate(); }
 
-void Shockwave::render(sf::RenderWindow& win, sf::Vector2<float> cam) { hit.render(win, cam); }
+void Shockwave::render(flfx::DrawList& win, sf::Vector2<float> cam) { hit.render(win, cam); }
 
 } // namespace entity
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <SFML/Graphics.hpp>
 #include "../../components/CircleSensor.hpp"
 #include "../../utils/Cooldown.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace world {
 class Map;
@@ -23,7 +24,7 @@ class Shockwave {
 	void update(automa::ServiceProvider& svc, world::Map& map);
 	void set_position(sf::Vector2<float> position);
 	void handle_player(player::Player& player);
-	void render(sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(flfx::DrawList& win, sf::Vector2<float> cam);
 
 	components::CircleSensor hit{};
 	sf::Vector2<float> position{};
@@ -16,7 +16,7 @@ void WeaponPackage::update(automa::ServiceProvider& svc, world::Map& map, enemy:
 	weapon.get()->firing_direction = enemy.directions.actual;
 }
 
-void WeaponPackage::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) { weapon->render(svc, win, cam); }
+void WeaponPackage::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) { weapon->render(svc, win, cam); }
 
 void WeaponPackage::shoot() { weapon->shoot(); }
 
@@ -3,6 +3,7 @@
 #include "../Entity.hpp"
 #include "../../weapon/Weapon.hpp"
 #include "../../utils/Cycle.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace enemy {
 class Enemy;
@@ -14,7 +15,7 @@ class WeaponPackage : public Entity {
   public:
 	WeaponPackage(automa::ServiceProvider& svc, std::string_view label, int id);
 	void update(automa::ServiceProvider& svc, world::Map& map, enemy::Enemy& enemy);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void shoot();
 	[[nodiscard]] auto get() -> arms::Weapon& { return *weapon; }
 	[[nodiscard]] auto barrel_point() -> sf::Vector2<float> { return weapon->barrel_point; }
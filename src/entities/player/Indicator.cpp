@@ -9,11 +9,9 @@ Indicator::Indicator(automa::ServiceProvider& svc) {}
 
 void Indicator::init(automa::ServiceProvider& svc, int id) {
 	meta.id = id;
-	font.loadFromFile(svc.text.title_font);
-	font.setSmooth(false);
 	label.setCharacterSize(16);
 	label.setLetterSpacing(0.6f);
-	label.setFont(font);
+	label.setFont(svc.text.fonts.title);
 	if (meta.id == 0) { color_fade = vfx::ColorFade({svc.styles.colors.ui_white, svc.styles.colors.red, svc.styles.colors.dark_fucshia}, 16, addition_time); }
 	if (meta.id == 1) { color_fade = vfx::ColorFade({svc.styles.colors.ui_white, svc.styles.colors.goldenrod, svc.styles.colors.dark_orange}, 16, addition_time); }
 	float fric{0.85f};
@@ -35,7 +33,7 @@ void Indicator::update(automa::ServiceProvider& svc, sf::Vector2<float> pos) {
 	position = gravitator.collider.physics.position + offset;
 }
 
-void Indicator::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Indicator::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (svc.greyblock_mode()) {
 		return;
 	} else if (!addition_limit.is_complete()) {
@@ -7,6 +7,7 @@
 #include "../../utils/Cooldown.hpp"
 #include "../../graphics/ColorFade.hpp"
 #include "../../particle/Gravitator.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -23,7 +24,7 @@ class Indicator {
 	Indicator(automa::ServiceProvider& svc);
 	void init(automa::ServiceProvider& svc, int id);
 	void update(automa::ServiceProvider& svc, sf::Vector2<float> pos = {0.f, 0.f});
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void add(float amount);
 	void set_position(sf::Vector2<float> pos);
 	void shift();
@@ -40,7 +41,6 @@ class Indicator {
 	} meta{};
 
 	sf::Text label{};
-	sf::Font font{};
 	util::Cooldown addition_limit{};
 	util::Cooldown fadeout{};
 	int fadeout_time{32};
@@ -25,6 +25,7 @@ void Player::init(automa::ServiceProvider& svc) {
 	collider.physics = components::PhysicsComponent({physics_stats.ground_fric, physics_stats.ground_fric}, physics_stats.mass);
 
 	collider.physics.set_constant_friction({physics_stats.ground_fric, physics_stats.air_fric});
+	collider.physics.enable_statistics();
 	collider.collision_depths = util::CollisionDepth();
 	// if (collider.collision_depths) { std::cout << "Depth instantiated.\n"; }
 
@@ -125,7 +126,7 @@ void Player::update(world::Map& map, gui::Console& console, gui::InventoryWindow
 	update_antennae();
 }
 
-void Player::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos) {
+void Player::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos) {
 
 	sf::Vector2<float> player_pos = apparent_position - campos;
 	calculate_sprite_offset();
@@ -177,10 +178,9 @@ void Player::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vec
 
 	if (controller.get_shield().active() && catalog.categories.abilities.has_ability(Abilities::shield)) { controller.get_shield().render(*m_services, win, campos); }
 
-	collider.flush_positions();
 }
 
-void Player::render_indicators(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Player::render_indicators(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (orb_indicator.active()) { health_indicator.shift(); }
 	health_indicator.render(svc, win, cam);
 	orb_indicator.render(svc, win, cam);
@@ -341,9 +341,10 @@ void Player::flash_sprite() {
 }
 
 void Player::calculate_sprite_offset() {
-	sprite_position = {collider.get_average_tick_position() + sprite_offset};
+	auto const position = collider.get_interpolated_position(m_services->ticker.get_alpha());
+	sprite_position = {position + sprite_offset};
 	sprite_position.x += controller.facing_left() ? -1.f : 1.f;
-	apparent_position = collider.get_average_tick_position() + collider.dimensions / 2.f;
+	apparent_position = position + collider.dimensions / 2.f;
 }
 
 void Player::jump(world::Map& map) {
@@ -431,8 +432,7 @@ void Player::shield() {
 void Player::set_position(sf::Vector2<float> new_pos, bool centered) {
 	sf::Vector2<float> offset{};
 	offset.x = centered ? collider.dimensions.x * 0.5f : 0.f;
-	collider.physics.position = new_pos - offset;
-	collider.sync_components();
+	collider.set_position(new_pos - offset);
 	update_direction();
 	sync_antennae();
 	health_indicator.set_position(new_pos);
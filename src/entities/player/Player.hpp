@@ -18,6 +18,7 @@
 #include "PlayerAnimation.hpp"
 #include "PlayerController.hpp"
 #include "Transponder.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace gui {
 class Console;
@@ -101,8 +102,8 @@ class Player {
 	void init(automa::ServiceProvider& svc);
 	// member functions
 	void update(world::Map& map, gui::Console& console, gui::InventoryWindow& inventory_window);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos);
-	void render_indicators(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos);
+	void render_indicators(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void assign_texture(sf::Texture& tex);
 	void update_animation();
 	void update_sprite();
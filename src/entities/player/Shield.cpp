@@ -81,7 +81,7 @@ void Shield::reset_all() {
 	flags.state = {};
 }
 
-void Shield::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Shield::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	sf::Vector2<float> offset{32.f, 36.f};
 	int u = animation.params.lookup * dimensions.x;
 	int v = animation.get_frame() * dimensions.y;
@@ -6,6 +6,7 @@
 #include "../../components/CircleSensor.hpp"
 #include "../animation/Animation.hpp"
 #include "../packages/Health.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -27,7 +28,7 @@ class Shield {
 	void damage(float amount = 0.f);
 	void reset_triggers();
 	void reset_all();
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 
 	[[nodiscard]] auto is_shielding() const -> bool { return flags.state.test(ShieldState::shielding); }
 	[[nodiscard]] auto recovering() const -> bool { return flags.state.test(ShieldState::recovery); }
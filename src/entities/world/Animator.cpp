@@ -52,7 +52,7 @@ void Animator::update(automa::ServiceProvider& svc, player::Player& player) {
 	int v = get_frame() * static_cast<int>(dimensions.y);
 	sprite.setTextureRect(sf::IntRect({u, v}, {sprite_dimensions.x, sprite_dimensions.y}));
 }
-void Animator::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Animator::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	activated ? drawbox.setOutlineColor(svc.styles.colors.green) : drawbox.setOutlineColor(svc.styles.colors.dark_orange);
 	drawbox.setSize(bounding_box.dimensions);
 	drawbox.setPosition(position.x - cam.x, position.y - cam.y);
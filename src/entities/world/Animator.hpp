@@ -6,6 +6,7 @@
 #include "../../utils/Shape.hpp"
 #include "../../utils/StateFunction.hpp"
 #include "../Entity.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -27,7 +28,7 @@ class Animator : public Entity {
 	Animator() = default;
 	Animator(automa::ServiceProvider& svc, sf::Vector2<int> pos, int id, bool large, bool automatic = false, bool foreground = false, int style = 0);
 	void update(automa::ServiceProvider& svc, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) override;
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) override;
 	int get_frame() const;
 	[[nodiscard]] auto foreground() const -> bool { return attributes.test(AnimatorAttributes::foreground); }
 
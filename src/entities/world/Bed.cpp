@@ -33,7 +33,7 @@ void Bed::update(automa::ServiceProvider& svc, world::Map& map, gui::Console& co
 	}
 }
 
-void Bed::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Bed::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (!fadeout.running()) { return; }
 	sparkler.render(svc, win, cam);
 }
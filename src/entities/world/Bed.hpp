@@ -4,6 +4,7 @@
 #include "../../particle/Sparkler.hpp"
 #include "../../utils/Collider.hpp"
 #include "../Entity.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -27,7 +28,7 @@ class Bed {
   public:
 	Bed(automa::ServiceProvider& svc, sf::Vector2<float> position);
 	void update(automa::ServiceProvider& svc, world::Map& map, gui::Console& console, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	shape::Shape bounding_box{};
   private:
 	vfx::Sparkler sparkler{};
@@ -86,7 +86,7 @@ void Chest::update(automa::ServiceProvider& svc, world::Map& map, gui::Console&
 	}
 }
 
-void Chest::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos) {
+void Chest::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos) {
 	sprite.setPosition(collider.physics.position.x - campos.x, collider.physics.position.y - campos.y + 1);
 	// get UV coords (only one row of sprites is supported)
 	int u = (int)(animation.get_frame() * sprite_dimensions.x);
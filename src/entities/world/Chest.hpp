@@ -7,6 +7,7 @@
 #include "../Entity.hpp"
 #include "../animation/Animation.hpp"
 #include "../item/Item.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -37,7 +38,7 @@ class Chest : public Entity {
   public:
 	Chest(automa::ServiceProvider& svc, int id);
 	void update(automa::ServiceProvider& svc, world::Map& map, gui::Console& console, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> campos);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> campos);
 	void set_position(sf::Vector2<float> pos);
 	void set_position_from_scaled(sf::Vector2<float> scaled_pos);
 	void set_id(int new_id);
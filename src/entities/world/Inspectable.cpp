@@ -56,7 +56,7 @@ void Inspectable::update(automa::ServiceProvider& svc, player::Player& player, g
 	if (console.is_complete()) { flags.reset(InspectableFlags::engaged); }
 }
 
-void Inspectable::render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos) {
+void Inspectable::render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos) {
 	sf::RectangleShape box{};
 	auto u = 0;
 	auto v = animation.get_frame() * 32;
@@ -6,6 +6,7 @@
 #include "../../utils/Shape.hpp"
 #include "../animation/Animation.hpp"
 #include "../../utils/Circuit.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -32,7 +33,7 @@ class Inspectable {
 	Inspectable() = default;
 	Inspectable(automa::ServiceProvider& svc, Vecu16 dim, Vecu16 pos, std::string_view key, int room_id, int alternates = 0, int native = 0, bool aoc = false);
 	void update(automa::ServiceProvider& svc, player::Player& player, gui::Console& console, dj::Json& set);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos);
 	void destroy() { flags.set(InspectableFlags::destroy); } 
 	[[nodiscard]] auto destroyed() const -> bool { return flags.test(InspectableFlags::destroy); }
 	[[nodiscard]] auto get_id() const -> std::string { return id; }
@@ -23,7 +23,7 @@ void Portal::update(automa::ServiceProvider& svc) {
 	bounding_box.dimensions = dimensions;
 }
 
-void Portal::render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos) {
+void Portal::render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos) {
 	if (svc.greyblock_mode()) {
 		sf::RectangleShape box{};
 		if (flags.state.test(PortalState::ready)) {
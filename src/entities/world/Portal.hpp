@@ -3,6 +3,7 @@
 
 #include "../../utils/Shape.hpp"
 #include "../../utils/BitFlags.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -29,7 +30,7 @@ class Portal {
 	Portal() = default;
 	Portal(automa::ServiceProvider& svc, Vecu32 dim, Vecu32 pos, int src, int dest, bool activate_on_contact, bool locked = false, int key_id = 0);
 	void update(automa::ServiceProvider& svc);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos); // for debugging
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos); // for debugging
 	void handle_activation(automa::ServiceProvider& svc, player::Player& player, gui::Console& console, int room_id, bool& fade_out, bool& done);
 	void change_states(automa::ServiceProvider& svc, int room_id, bool& fade_out, bool& done) const;
 	[[nodiscard]] auto get_source() const -> int { return meta.source_map_id; }
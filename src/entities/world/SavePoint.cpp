@@ -1,5 +1,6 @@
 
 #include "SavePoint.hpp"
+#include <iostream>
 
 #include "../../service/ServiceProvider.hpp"
 #include "../player/Player.hpp"
@@ -47,7 +48,6 @@ void SavePoint::update(automa::ServiceProvider& svc, player::Player& player, gui
 					activated = true;
 					save(svc, player);
 					svc.state_controller.save_point_id = id;
-					svc.soundboard.flags.world.set(audio::World::soft_sparkle);
 					console.set_source(svc.text.basic);
 					console.load_and_launch("save");
 				}
@@ -63,7 +63,7 @@ void SavePoint::update(automa::ServiceProvider& svc, player::Player& player, gui
 	}
 }
 
-void SavePoint::render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos) {
+void SavePoint::render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos) {
 
 	sparkler.render(svc, win, campos);
 
@@ -83,7 +83,15 @@ void SavePoint::render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec
 }
 
 void SavePoint::save(automa::ServiceProvider& svc, player::Player& player) {
-	svc.data.save_progress(player, id);
+	// the sparkle waits for the file to reach the disk, so it confirms the save rather than the button press
+	svc.data.save_progress(player, id, [&svc](bool saved) {
+		if (saved) {
+			svc.soundboard.flags.world.set(audio::World::soft_sparkle);
+		} else {
+			std::cout << "> failed to write save file " << svc.data.current_save << "\n";
+		}
+	});
+	svc.snapshots.save_point.capture(svc, player, id);
 	can_activate = false;
 }
 
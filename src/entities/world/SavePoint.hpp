@@ -6,6 +6,7 @@
 #include "../../utils/Shape.hpp"
 #include "../animation/Animation.hpp"
 #include "../../particle/Sparkler.hpp"
+#include "../../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -33,7 +34,7 @@ class SavePoint {
 	SavePoint(automa::ServiceProvider& svc);
 
 	void update(automa::ServiceProvider& svc, player::Player& player, gui::Console& console);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos);
 
 	void save(automa::ServiceProvider& svc, player::Player& player); // talk to SaveDataManager to write current progress to save.json
 
@@ -63,7 +63,7 @@ void Background::update(automa::ServiceProvider& svc, sf::Vector2<float> observe
 	}
 }
 
-void Background::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float>& campos, sf::Vector2<float>& mapdim) {
+void Background::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float>& campos, sf::Vector2<float>& mapdim) {
 	if (behavior.scrolling) {
 		auto idx{0};
 		for (auto& sprite : sprites) {
@@ -5,6 +5,7 @@
 #include <array>
 #include <unordered_map>
 #include "../components/PhysicsComponent.hpp"
+#include "DrawList.hpp"
 
 
 namespace automa {
@@ -22,7 +23,7 @@ class Background {
 	Background(automa::ServiceProvider& svc, int bg_id);
 
 	void update(automa::ServiceProvider& svc, sf::Vector2<float> observed_camvel);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float>& campos, sf::Vector2<float>& mapdim);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float>& campos, sf::Vector2<float>& mapdim);
 
   private:
 	std::vector<sf::Sprite> sprites{};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <variant>
+#include <vector>
+
+namespace flfx {
+
+// one frame of draw commands recorded on the simulation thread and replayed on the render thread.
+// drawables are copied by value, so later changes to the originals never show up in a snapshot.
+// textures and fonts are referenced, not copied, and must outlive the frame (see Renderer::flush).
+class DrawList {
+  public:
+	using Command = std::variant<sf::Sprite, sf::Text, sf::RectangleShape, sf::CircleShape, sf::ConvexShape, sf::View>;
+
+	void draw(sf::Sprite const& sprite) { commands.emplace_back(sprite); }
+	void draw(sf::RectangleShape const& shape) { commands.emplace_back(shape); }
+	void draw(sf::CircleShape const& shape) { commands.emplace_back(shape); }
+	void draw(sf::ConvexShape const& shape) { commands.emplace_back(shape); }
+	void draw(sf::Text const& text) {
+		// build the glyph geometry here so the render thread never touches the font's glyph table.
+		// the glyphs themselves are loaded before the renderer starts (see TextManager::warm_glyphs), so this only reads them.
+		static_cast<void>(text.getLocalBounds());
+		commands.emplace_back(text);
+	}
+	void setView(sf::View const& view) { commands.emplace_back(view); }
+	void clear() { commands.clear(); }
+
+	// draws every command in order, starting from the target's default view
+	void replay(sf::RenderTarget& target) const {
+		target.setView(target.getDefaultView());
+		for (auto const& command : commands) {
+			std::visit(
+				[&target](auto const& item) {
+					if constexpr (std::is_same_v<std::decay_t<decltype(item)>, sf::View>) {
+						target.setView(item);
+					} else {
+						target.draw(item);
+					}
+				},
+				command);
+		}
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t { return commands.size(); }
+	[[nodiscard]] auto empty() const -> bool { return commands.empty(); }
+
+  private:
+	std::vector<Command> commands{}; // cleared, not freed, so capacity is reused frame to frame
+};
+
+} // namespace flfx
@@ -5,18 +5,16 @@
 namespace text {
 
 void HelpText::init(automa::ServiceProvider& svc, std::string start, std::string_view code, std::string end, int delay_time, bool include_background) {
-	font.loadFromFile(svc.text.text_font);
-	font.setSmooth(false);
 	text_color = svc.styles.colors.ui_white;
 	text_color.a = 0;
 	bg_color = svc.styles.colors.ui_black;
 	bg_color.a = 0;
 	data.setCharacterSize(text_size);
-	data.setFont(font);
+	data.setFont(svc.text.fonts.text);
 	data.setLineSpacing(1.5f);
 	marker = start + svc.controller_map.tag_to_label.at(code).data() + end;
 	data.setString(marker);
-	data.setFont(font);
+	data.setFont(svc.text.fonts.text);
 	data.setCharacterSize(text_size);
 	data.setOrigin(data.getLocalBounds().getSize() * 0.5f);
 	position = {static_cast<float>(svc.constants.screen_dimensions.x) * 0.5f, static_cast<float>(svc.constants.screen_dimensions.y) - 2.f * pad};
@@ -25,7 +23,7 @@ void HelpText::init(automa::ServiceProvider& svc, std::string start, std::string
 	background = include_background;
 }
 
-void HelpText::render(sf::RenderWindow& win) {
+void HelpText::render(flfx::DrawList& win) {
 	delay.update();
 	if (!ready()) { return; }
 	alpha_counter.update();
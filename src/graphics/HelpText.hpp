@@ -4,6 +4,7 @@
 #include <string_view>
 #include "../utils/Cooldown.hpp"
 #include "../utils/Counter.hpp"
+#include "DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -14,7 +15,7 @@ namespace text {
 class HelpText {
   public:
 	void init(automa::ServiceProvider& svc, std::string start, std::string_view code = "", std::string end = "", int delay_time = 195, bool include_background = false);
-	void render(sf::RenderWindow& win);
+	void render(flfx::DrawList& win);
 	void set_color(sf::Color color);
 	void set_string(std::string string);
 	void set_alpha(uint8_t a);
@@ -32,7 +33,6 @@ class HelpText {
 	int text_size{16};
 	sf::Color text_color{};
 	sf::Color bg_color{};
-	sf::Font font{};
 	float pad{30};
 	bool background{};
 	sf::Vector2<float> position{};
@@ -1,6 +1,6 @@
 #include "MapTexture.hpp"
 #include "../service/ServiceProvider.hpp"
-#include "../level/Map.hpp"
+#include "../setup/RoomData.hpp"
 #include <algorithm>
 
 namespace gui {
@@ -20,46 +20,44 @@ MapTexture::MapTexture(automa::ServiceProvider& svc) {
 	save_box.setSize({4.f, 4.f});
 }
 
-void MapTexture::bake(automa::ServiceProvider& svc, world::Map& map, int room, float scale, bool current, bool undiscovered) {
-	map.load(svc, room, true);
-	global_offset = map.metagrid_coordinates * 16;
-	auto const& middleground = map.get_layers().at(world::MIDDLEGROUND);
-	map_texture.create(map.dimensions.x * static_cast<unsigned int>((32.f / scale)), map.dimensions.y * static_cast<unsigned int>(32.f / scale));
+void MapTexture::bake(automa::ServiceProvider& svc, data::RoomOutline const& room, float scale, bool current, bool undiscovered) {
+	global_offset = room.meta.metagrid * 16;
+	auto const dimensions = sf::Vector2<unsigned int>{room.meta.dimensions};
+	auto const cell = svc.constants.cell_size / scale;
+	map_texture.create(dimensions.x * static_cast<unsigned int>((32.f / scale)), dimensions.y * static_cast<unsigned int>(32.f / scale));
 	map_texture.clear(sf::Color::Transparent);
-	for (auto& cell : middleground.grid.cells) {
-		if (cell.is_occupied() && !cell.is_breakable()) {
-			tile_box.setPosition(cell.position / scale);
-			sf::Color diff = tile_color;
-			auto darkener = current ? 0 : 40;
-			auto g_diff = cell.value / 8;
-			diff.g = std::clamp(diff.g + g_diff - darkener, 0, 255);
-			auto r_diff = cell.value / 4;
-			diff.r = std::clamp(diff.r + r_diff - darkener / 2, 0, 255);
-			auto b_diff = cell.value / 4;
-			diff.b = std::clamp(diff.b + b_diff - darkener / 2, 0, 255);
-			if (cell.surrounded) { diff.b = std::clamp(diff.b - 40, 0, 255); }
-			if (cell.surrounded) { diff.g = std::clamp(diff.g - 60, 0, 255); }
-			if (cell.surrounded) { diff.r = std::clamp(diff.r - 20, 0, 255); }
-			tile_box.setFillColor(current ? diff : diff);
-			map_texture.draw(tile_box);
-		}
+	for (auto const& tile : room.tiles) {
+		tile_box.setPosition(sf::Vector2<float>{tile.index} * cell);
+		sf::Color diff = tile_color;
+		auto darkener = current ? 0 : 40;
+		auto g_diff = tile.value / 8;
+		diff.g = std::clamp(diff.g + g_diff - darkener, 0, 255);
+		auto r_diff = tile.value / 4;
+		diff.r = std::clamp(diff.r + r_diff - darkener / 2, 0, 255);
+		auto b_diff = tile.value / 4;
+		diff.b = std::clamp(diff.b + b_diff - darkener / 2, 0, 255);
+		if (tile.surrounded) { diff.b = std::clamp(diff.b - 40, 0, 255); }
+		if (tile.surrounded) { diff.g = std::clamp(diff.g - 60, 0, 255); }
+		if (tile.surrounded) { diff.r = std::clamp(diff.r - 20, 0, 255); }
+		tile_box.setFillColor(diff);
+		map_texture.draw(tile_box);
 	}
-	for (auto& portal : map.portals) {
-		portal_box.setPosition(portal.position / scale);
-		portal_box.setSize(portal.dimensions / scale);
+	for (auto const& portal : room.portals) {
+		portal_box.setPosition(sf::Vector2<float>{portal.position} * cell);
+		portal_box.setSize(sf::Vector2<float>{portal.dimensions} * cell);
 		map_texture.draw(portal_box);
 	}
-	for (auto& breakable : map.breakables) {
-		breakable_box.setPosition(breakable.get_bounding_box().position / scale);
-		breakable_box.setSize(breakable.get_bounding_box().dimensions / scale);
+	for (auto const& breakable : room.breakables) {
+		breakable_box.setPosition(sf::Vector2<float>{breakable} * cell);
+		breakable_box.setSize({cell, cell});
 		map_texture.draw(breakable_box);
 	}
-	if (map.save_point.id > 0) {
-		save_box.setPosition(sf::Vector2 <float>(map.save_point.scaled_position) * 32.f / scale);
+	if (room.save_point && room.meta.room_id > 0) {
+		save_box.setPosition(sf::Vector2<float>{*room.save_point} * cell);
 		map_texture.draw(save_box);
 	}
-	if (undiscovered) { 
-		curtain.setSize({static_cast<float>(map.dimensions.x) * (32.f / scale), static_cast<float>(map.dimensions.y) * (32.f / scale)});
+	if (undiscovered) {
+		curtain.setSize({static_cast<float>(dimensions.x) * (32.f / scale), static_cast<float>(dimensions.y) * (32.f / scale)});
 		curtain.setFillColor(svc.styles.colors.navy_blue);
 		map_texture.draw(curtain);
 	}
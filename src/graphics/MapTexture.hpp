@@ -8,8 +8,8 @@ namespace automa {
 struct ServiceProvider;
 }
 
-namespace world {
-class Map;
+namespace data {
+struct RoomOutline;
 }
 
 namespace gui {
@@ -20,7 +20,7 @@ class MapTexture {
   public:
 	MapTexture() = default;
 	MapTexture(automa::ServiceProvider& svc);
-	void bake(automa::ServiceProvider& svc, world::Map& map, int room, float scale, bool current = false, bool undiscovered = false);
+	void bake(automa::ServiceProvider& svc, data::RoomOutline const& room, float scale, bool current = false, bool undiscovered = false);
 	void set_current() { flags.set(MapTextureFlags::current); }
 	[[nodiscard]] auto is_current() const -> bool { return flags.test(MapTextureFlags::current); }
 	sf::Sprite sprite();
@@ -0,0 +1,84 @@
+#include "Renderer.hpp"
+#include <iostream>
+
+namespace flfx {
+
+void Renderer::start() {
+	if (running()) { return; }
+	stopping = false;
+	window->setActive(false); // a context can only be current on one thread
+	thread = std::thread([this] { present(); });
+}
+
+void Renderer::stop() {
+	if (!running()) { return; }
+	{
+		auto lock = std::unique_lock{mutex};
+		stopping = true;
+	}
+	signal.notify_all();
+	thread.join();
+	window->setActive(true);
+	for (auto& list : lists) { list.clear(); }
+	fresh = false;
+}
+
+void Renderer::submit() {
+	{
+		auto lock = std::unique_lock{mutex};
+		signal.wait(lock, [this] { return !fresh || stopping; });
+		std::swap(writing, ready);
+		fresh = true;
+	}
+	signal.notify_all();
+	lists.at(writing).clear();
+}
+
+void Renderer::flush() {
+	auto lock = std::unique_lock{mutex};
+	signal.wait(lock, [this] { return !busy || stopping; });
+	for (auto& list : lists) { list.clear(); }
+	fresh = false;
+}
+
+void Renderer::capture(std::string filename) {
+	auto lock = std::unique_lock{mutex};
+	screenshot = std::move(filename);
+}
+
+void Renderer::present() {
+	window->setActive(true);
+	auto capture = sf::Texture{};
+	while (true) {
+		auto filename = std::string{};
+		{
+			auto lock = std::unique_lock{mutex};
+			signal.wait(lock, [this] { return fresh || stopping; });
+			if (stopping) { break; }
+			std::swap(ready, presenting);
+			fresh = false;
+			busy = true;
+			filename = std::move(screenshot);
+			screenshot.clear();
+		}
+		signal.notify_all();
+
+		window->clear();
+		lists.at(presenting).replay(*window);
+		if (!filename.empty()) {
+			if (capture.getSize() != window->getSize()) { capture.create(window->getSize().x, window->getSize().y); }
+			capture.update(*window);
+			if (capture.copyToImage().saveToFile(filename)) { std::cout << "screenshot saved to " << filename << std::endl; }
+		}
+		window->display();
+
+		{
+			auto lock = std::unique_lock{mutex};
+			busy = false;
+		}
+		signal.notify_all();
+	}
+	window->setActive(false);
+}
+
+} // namespace flfx
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "DrawList.hpp"
+
+namespace flfx {
+
+// presents draw lists on a dedicated thread that owns the window's gl context.
+// three lists rotate between the simulation (writing), the hand-off slot (ready) and the render thread (presenting),
+// so the next frame is recorded while the last one is drawn and frame time is the slower of the two instead of their sum.
+class Renderer {
+  public:
+	explicit Renderer(sf::RenderWindow& window) : window(&window) {}
+	~Renderer() { stop(); }
+	Renderer(Renderer const&) = delete;
+	Renderer& operator=(Renderer const&) = delete;
+
+	void start();
+	void stop();
+	// hands the recorded list to the render thread. blocks while the previous hand-off has not been picked up yet.
+	void submit();
+	// waits for the render thread to finish its frame and drops every list. call before freeing anything a list may reference.
+	void flush();
+	// saves the next presented frame to filename
+	void capture(std::string filename);
+
+	[[nodiscard]] auto get_list() -> DrawList& { return lists.at(writing); }
+	[[nodiscard]] auto running() const -> bool { return thread.joinable(); }
+
+  private:
+	void present();
+
+	sf::RenderWindow* window;
+	std::array<DrawList, 3> lists{};
+	std::size_t writing{0};
+	std::size_t ready{1};
+	std::size_t presenting{2};
+
+	std::thread thread{};
+	std::mutex mutex{};
+	std::condition_variable signal{};
+	bool fresh{};	 // ready holds a list the render thread has not picked up
+	bool busy{};	 // the render thread is drawing presenting
+	bool stopping{};
+	std::string screenshot{};
+};
+
+} // namespace flfx
@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <deque>
+#include "DrawList.hpp"
 
 namespace flfx {
 
@@ -25,7 +26,7 @@ class SpriteHistory {
 			positions.pop_front();
 		}
 	}
-	void drag(sf::RenderWindow& win, sf::Vector2<float> cam) {
+	void drag(flfx::DrawList& win, sf::Vector2<float> cam) {
 		auto a{100};
 		auto ctr{0};
 		for (auto& sp : sprites) {
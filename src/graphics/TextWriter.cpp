@@ -6,8 +6,6 @@
 namespace text {
 
 TextWriter::TextWriter(automa::ServiceProvider& svc) : m_services(&svc) {
-	font.loadFromFile(svc.text.text_font);
-	font.setSmooth(false);
 	special_characters.insert({Codes::prompt, '%'});
 	special_characters.insert({Codes::quest, '$'});
 	special_characters.insert({Codes::item, '^'});
@@ -152,7 +150,7 @@ void TextWriter::append(std::string_view content) {
 void TextWriter::stylize(sf::Text& msg, bool is_suite) const {
 	msg.setCharacterSize(text_size);
 	msg.setFillColor(m_services->styles.colors.ui_white);
-	msg.setFont(font);
+	msg.setFont(m_services->text.fonts.text);
 	msg.setLineSpacing(1.5f);
 	if (is_suite) {
 		msg.setPosition(position);
@@ -160,13 +158,13 @@ void TextWriter::stylize(sf::Text& msg, bool is_suite) const {
 		msg.setPosition(response_position);
 	}
 }
-	void TextWriter::write_instant_message(sf::RenderWindow& win) {
+	void TextWriter::write_instant_message(flfx::DrawList& win) {
 	if (iterators.current_suite_set >= suite.size()) { return; }
 	if (suite.at(iterators.current_suite_set).empty()) { return; }
 	win.draw(suite.at(iterators.current_suite_set).front().data);
 }
 
-void TextWriter::write_gradual_message(sf::RenderWindow& win) {
+void TextWriter::write_gradual_message(flfx::DrawList& win) {
 	if (iterators.current_suite_set >= suite.size()) { return; }
 	if (suite.at(iterators.current_suite_set).empty()) { return; }
 	if (!writing()) {
@@ -179,7 +177,7 @@ void TextWriter::write_gradual_message(sf::RenderWindow& win) {
 	win.draw(working_message);
 }
 
-void TextWriter::write_responses(sf::RenderWindow& win) {
+void TextWriter::write_responses(flfx::DrawList& win) {
 	if (iterators.current_response_set >= responses.size()) { return; }
 	if (selection_mode()) {
 		sf::Vector2<float> newpos{position.x + response_offset.x, position.y + response_offset.y};
@@ -16,6 +16,7 @@
 #include "../utils/QuestCode.hpp"
 #include "../utils/Decoder.hpp"
 #include "../graphics/HelpText.hpp"
+#include "DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -47,9 +48,9 @@ class TextWriter {
 	void load_message(dj::Json& source, std::string_view key);
 	void append(std::string_view content);
 	void stylize(sf::Text& msg, bool is_suite) const;
-	void write_instant_message(sf::RenderWindow& win);
-	void write_gradual_message(sf::RenderWindow& win);
-	void write_responses(sf::RenderWindow& win);
+	void write_instant_message(flfx::DrawList& win);
+	void write_gradual_message(flfx::DrawList& win);
+	void write_responses(flfx::DrawList& win);
 	void activate();
 	void deactivate();
 	void request_next();
@@ -117,7 +118,6 @@ class TextWriter {
 	HelpText help_marker;
 
 	std::string working_str{};
-	sf::Font font{};
 	int glyph_count{};
 	int tick_count{};
 	int writing_speed{default_writing_speed};
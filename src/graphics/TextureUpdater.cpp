@@ -102,7 +102,7 @@ void TextureUpdater::update_texture(sf::Texture& texture) {
 	image.clear();
 }
 
-void flfx::TextureUpdater::debug_render(sf::RenderWindow& win, sf::Vector2<float>& campos) {
+void flfx::TextureUpdater::debug_render(flfx::DrawList& win, sf::Vector2<float>& campos) {
 	debug.setSize({8.f, 8.f});
 	int i{};
 	for (auto& color : map_colors) {
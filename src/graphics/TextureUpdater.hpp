@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include "DrawList.hpp"
 
 namespace flfx {
 
@@ -15,7 +16,7 @@ class TextureUpdater {
 	void load_palette(sf::Texture& palette_texture);
 	void update_texture(sf::Texture& texture);
 
-	void debug_render(sf::RenderWindow& win, sf::Vector2<float>& campos);
+	void debug_render(flfx::DrawList& win, sf::Vector2<float>& campos);
 
 	sf::Texture& get_dynamic_texture();
 
@@ -35,7 +35,7 @@ void Transition::update(player::Player& player) {
 	}
 }
 
-void Transition::render(sf::RenderWindow& win) {
+void Transition::render(flfx::DrawList& win) {
 	if (fade_out || fade_in || done) {
 		color.a = alpha;
 		box.setFillColor(color);
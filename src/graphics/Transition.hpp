@@ -3,6 +3,7 @@
 
 #include <SFML/Graphics.hpp>
 #include <array>
+#include "DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -20,7 +21,7 @@ class Transition {
 	Transition(automa::ServiceProvider& svc, int d);
 
 	void update(player::Player& player);
-	void render(sf::RenderWindow& win);
+	void render(flfx::DrawList& win);
 
 	int const duration{};
 	int current_frame{};
@@ -33,7 +33,7 @@ void Tutorial::update(automa::ServiceProvider& svc) {
 	}
 }
 
-void Tutorial::render(sf::RenderWindow& win) {
+void Tutorial::render(flfx::DrawList& win) {
 	if (helpers.test(TutorialHelpers::closed)) { return; }
 	if (helpers.test(TutorialHelpers::render)) { help_marker.render(win); }
 }
@@ -5,6 +5,7 @@
 #include "../utils/Cooldown.hpp"
 #include "../utils/BitFlags.hpp"
 #include "HelpText.hpp"
+#include "DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -18,7 +19,7 @@ enum class TutorialFlags { jump, sprint, inventory, shoot, map };
 class Tutorial {
   public:
 	void update(automa::ServiceProvider& svc);
-	void render(sf::RenderWindow& win);
+	void render(flfx::DrawList& win);
 	void turn_on();
 	void turn_off();
 	void close_for_good();
@@ -55,7 +55,7 @@ void Console::update(automa::ServiceProvider& svc) {
 	}
 }
 
-void Console::render(sf::RenderWindow& win) {
+void Console::render(flfx::DrawList& win) {
 	for (auto& sprite : sprites) { win.draw(sprite); }
 	if (flags.test(ConsoleFlags::display_item)) { item_widget.render(*m_services, win); }
 	if (flags.test(ConsoleFlags::portrait_included)) {
@@ -93,7 +93,7 @@ void Console::display_gun(int gun_id) {
 	item_widget.set_id(gun_id, true);
 }
 
-void Console::write(sf::RenderWindow& win, bool instant) {
+void Console::write(flfx::DrawList& win, bool instant) {
 	if (!flags.test(ConsoleFlags::active)) { return; }
 	instant ? writer.write_instant_message(win) : writer.write_gradual_message(win);
 	writer.write_responses(win);
@@ -9,6 +9,7 @@
 #include "Portrait.hpp"
 #include "ItemWidget.hpp"
 #include "../utils/QuestCode.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace gui {
 
@@ -36,14 +37,14 @@ class Console {
 
 	void begin();
 	void update(automa::ServiceProvider& svc);
-	void render(sf::RenderWindow& win);
+	void render(flfx::DrawList& win);
 
 	void set_source(dj::Json& json);
 	void set_texture(sf::Texture& tex);
 	void load_and_launch(std::string_view key);
 	void display_item(int item_id);
 	void display_gun(int gun_id);
-	void write(sf::RenderWindow& win, bool instant = true);
+	void write(flfx::DrawList& win, bool instant = true);
 	void append(std::string_view key);
 	void end();
 	void end_tick();
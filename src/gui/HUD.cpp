@@ -41,8 +41,8 @@ void HUD::update(automa::ServiceProvider& svc, player::Player& player) {
 	for (auto& heart : hearts) {
 		heart.position = {corner_pad.x + i * heart_dimensions.x + i * HP_pad, corner_pad.y};
 		if (hp.flags.test(entity::HPState::hit)) {
-			auto randx = svc.random.random_range_float(-16.f, 16.f);
-			auto randy = svc.random.random_range_float(-16.f, 16.f);
+			auto randx = svc.random.vfx.random_range_float(-16.f, 16.f);
+			auto randy = svc.random.vfx.random_range_float(-16.f, 16.f);
 			heart.gravitator.set_position(heart.position + sf::Vector2<float>{randx, randy});
 		}
 		heart.update(svc, player);
@@ -67,7 +67,7 @@ void HUD::update(automa::ServiceProvider& svc, player::Player& player) {
 	if (player.arsenal) { gun_name = player.equipped_weapon().label; }
 }
 
-void HUD::render(player::Player& player, sf::RenderWindow& win) {
+void HUD::render(player::Player& player, flfx::DrawList& win) {
 
 	// HEARTS
 	for (auto& heart : hearts) { heart.render(win); }
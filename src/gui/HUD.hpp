@@ -12,6 +12,7 @@
 #include "../particle/Gravitator.hpp"
 #include "Widget.hpp"
 #include "../utils/Stopwatch.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -32,7 +33,7 @@ class HUD {
 	HUD() = default;
 	HUD(automa::ServiceProvider& svc, player::Player& player, sf::Vector2<int> pos);
 	void update(automa::ServiceProvider& svc, player::Player& player);
-	void render(player::Player& player, sf::RenderWindow& win);
+	void render(player::Player& player, flfx::DrawList& win);
 	void set_corner_pad(automa::ServiceProvider& svc, bool file_preview = false);
 
 	sf::Vector2<int> position{};
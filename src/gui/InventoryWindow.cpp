@@ -8,16 +8,12 @@ namespace gui {
 InventoryWindow::InventoryWindow(automa::ServiceProvider& svc) : Console::Console(svc), info(svc), selector(svc, {2, 1}), minimap(svc) {
 	title.setString("INVENTORY");
 	title.setCharacterSize(ui.title_size);
-	title_font.loadFromFile(svc.text.title_font);
-	title_font.setSmooth(false);
-	title.setFont(title_font);
+	title.setFont(svc.text.fonts.title);
 	title.setFillColor(svc.styles.colors.ui_white);
 	title.setLetterSpacing(2.f);
 
-	item_font.loadFromFile(svc.text.title_font);
-	item_font.setSmooth(false);
 	item_label.setCharacterSize(ui.desc_size);
-	item_label.setFont(item_font);
+	item_label.setFont(svc.text.fonts.title);
 	item_label.setFillColor(svc.styles.colors.ui_white);
 
 	info.set_texture(svc.assets.t_console_outline);
@@ -77,7 +73,7 @@ void InventoryWindow::update(automa::ServiceProvider& svc, player::Player& playe
 	}
 }
 
-void InventoryWindow::render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void InventoryWindow::render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (!active()) { return; }
 	Console::render(win);
 	win.draw(title);
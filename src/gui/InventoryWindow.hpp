@@ -3,6 +3,7 @@
 #include "Console.hpp"
 #include "Selector.hpp"
 #include "MiniMap.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace player {
 class Player;
@@ -17,7 +18,7 @@ class InventoryWindow : public Console {
 	InventoryWindow() = default;
 	InventoryWindow(automa::ServiceProvider& svc);
 	void update(automa::ServiceProvider& svc, player::Player& player, world::Map& map);
-	void render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win, sf::Vector2<float> cam);
 	void open();
 	void close();
 	void set_item_size(int sz) {
@@ -47,10 +48,8 @@ class InventoryWindow : public Console {
 	} ui{};
 
 	sf::Text title{};
-	sf::Font title_font{};
 
 	sf::Text item_label{};
-	sf::Font item_font{};
 };
 
 } // namespace gui
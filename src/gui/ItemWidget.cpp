@@ -36,7 +36,7 @@ void ItemWidget::update(automa::ServiceProvider& svc) {
 	sparkler.set_position(sticker.getPosition() - sparkler.get_dimensions() * 0.5f);
 }
 
-void ItemWidget::render(automa::ServiceProvider& svc, sf::RenderWindow& win) {
+void ItemWidget::render(automa::ServiceProvider& svc, flfx::DrawList& win) {
 	win.draw(sticker);
 	auto u = static_cast<int>(((id - 1) % 16) * dimensions.x);
 	auto v = static_cast<int>(std::floor((static_cast<float>(id - 1) / 16.f)) * dimensions.y);
@@ -3,6 +3,7 @@
 #include <string_view>
 #include "../particle/Gravitator.hpp"
 #include "../particle/Sparkler.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -17,7 +18,7 @@ class ItemWidget {
 	ItemWidget() = default;
 	ItemWidget(automa::ServiceProvider& svc);
 	void update(automa::ServiceProvider& svc);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win);
 	void reset(automa::ServiceProvider& svc);
 	void set_position(sf::Vector2<float> pos);
 	void bring_in();
@@ -29,10 +29,11 @@ MiniMap::MiniMap(automa::ServiceProvider& svc) : texture(svc) {
 	toggle_scale();
 }
 
-void MiniMap::bake(automa::ServiceProvider& svc, world::Map& map, int room, bool current, bool undiscovered) {
+// undiscovered rooms are covered by a curtain, so only their size and place are read
+void MiniMap::bake(automa::ServiceProvider& svc, int room, bool current, bool undiscovered) {
 	atlas.push_back(std::make_unique<MapTexture>(svc));
 	if (current) { atlas.back()->set_current(); }
-	atlas.back()->bake(svc, map, room, scale, current, undiscovered);
+	atlas.back()->bake(svc, svc.data.room_cache.get_outline(room, !undiscovered), scale, current, undiscovered);
 }
 
 void MiniMap::update(automa::ServiceProvider& svc, world::Map& map, player::Player& player) {
@@ -45,7 +46,7 @@ void MiniMap::update(automa::ServiceProvider& svc, world::Map& map, player::Play
 	center_position = (position - view.getCenter()) / ratio;
 }
 
-void MiniMap::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void MiniMap::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	// render minimap
 	global_ratio = ratio * 0.25f;
 	win.setView(view);
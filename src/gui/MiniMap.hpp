@@ -6,6 +6,7 @@
 #include "../level/Map.hpp"
 #include "../graphics/MapTexture.hpp"
 #include "../utils/Circuit.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace player {
 class Player;
@@ -31,9 +32,9 @@ class MiniMap {
   public:
 	MiniMap() = default;
 	MiniMap(automa::ServiceProvider& svc);
-	void bake(automa::ServiceProvider& svc, world::Map& map, int room, bool current = false, bool undiscovered = false);
+	void bake(automa::ServiceProvider& svc, int room, bool current = false, bool undiscovered = false);
 	void update(automa::ServiceProvider& svc, world::Map& map, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void toggle_scale();
 	void move(sf::Vector2<float> direction);
 	void center();
@@ -7,17 +7,13 @@ namespace gui {
 PauseWindow::PauseWindow(automa::ServiceProvider& svc) : Console::Console(svc), selector(svc, {2, 1}) {
 	title.setString("PAUSED");
 	title.setCharacterSize(ui.title_size);
-	title_font.loadFromFile(svc.text.title_font);
-	title_font.setSmooth(false);
-	title.setFont(title_font);
+	title.setFont(svc.text.fonts.title);
 	title.setFillColor(svc.styles.colors.ui_white);
 	title.setLetterSpacing(2.f);
 
-	widget_font.loadFromFile(svc.text.text_font);
-	widget_font.setSmooth(false);
 	widget_label.setString("Press [Enter] to return to Main Menu.");
 	widget_label.setCharacterSize(ui.widget_size);
-	widget_label.setFont(widget_font);
+	widget_label.setFont(svc.text.fonts.text);
 	widget_label.setFillColor(svc.styles.colors.ui_white);
 
 	help_marker.init(svc, "Press [", "menu_toggle_secondary", "] to resume game.", 20, true);
@@ -42,7 +38,7 @@ void PauseWindow::update(automa::ServiceProvider& svc, player::Player& player) {
 	selector.update();
 }
 
-void PauseWindow::render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win) {
+void PauseWindow::render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win) {
 	if (!active()) { return; }
 	Console::render(win);
 	win.draw(title);
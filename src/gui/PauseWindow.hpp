@@ -1,6 +1,7 @@
 #pragma once
 #include "Console.hpp"
 #include "Selector.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace player {
 class Player;
@@ -13,7 +14,7 @@ class PauseWindow : public Console {
 	PauseWindow() = default;
 	PauseWindow(automa::ServiceProvider& svc);
 	void update(automa::ServiceProvider& svc, player::Player& player);
-	void render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win);
+	void render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win);
 	void open();
 	void close();
 
@@ -29,11 +30,9 @@ class PauseWindow : public Console {
 	} ui{};
 
 	sf::Text title{};
-	sf::Font title_font{};
 	text::HelpText help_marker;
 
 	sf::Text widget_label{};
-	sf::Font widget_font{};
 };
 
 } // namespace gui
@@ -25,13 +25,13 @@ void Portrait::update(automa::ServiceProvider& svc) {
 	sprite.setPosition(gravitator.collider.physics.position);
 }
 
-void Portrait::render(sf::RenderWindow& win) {
+void Portrait::render(flfx::DrawList& win) {
 	sprite.setTextureRect(sf::IntRect({id * (int)dimensions.x, (emotion - 1) * (int)dimensions.y}, {(int)dimensions.x, (int)dimensions.y}));
 	win.draw(sprite);
 }
 
 void Portrait::reset(automa::ServiceProvider& svc) {
-	auto rand_y = svc.random.random_range_float(-60.f, 60.f);
+	auto rand_y = svc.random.vfx.random_range_float(-60.f, 60.f);
 	start_position = {-128.f, position.y};
 	if (is_nani) { start_position.x = svc.constants.screen_dimensions.x + 132.f; }
 	set_position(start_position);
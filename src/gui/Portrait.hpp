@@ -2,6 +2,7 @@
 #pragma once
 #include <string_view>
 #include "../particle/Gravitator.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -15,7 +16,7 @@ class Portrait {
 	Portrait() = default;
 	Portrait(automa::ServiceProvider& svc, bool left = true);
 	void update(automa::ServiceProvider& svc);
-	void render(sf::RenderWindow& win);
+	void render(flfx::DrawList& win);
 	void reset(automa::ServiceProvider& svc);
 	void set_position(sf::Vector2<float> pos);
 	void bring_in();
@@ -12,7 +12,7 @@ Selector::Selector(automa::ServiceProvider& svc, sf::Vector2<int> dim) : table_d
 
 void Selector::update() { sprite.setPosition(position); }
 
-void Selector::render(sf::RenderWindow& win) const { win.draw(sprite); }
+void Selector::render(flfx::DrawList& win) const { win.draw(sprite); }
 
 void Selector::go_down() {
 	current_selection.modulate(table_dimensions.x);
@@ -3,6 +3,7 @@
 #include <SFML/Graphics.hpp>
 #include <string_view>
 #include "../utils/Circuit.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -15,7 +16,7 @@ class Selector {
 	Selector() = default;
 	Selector(automa::ServiceProvider& svc, sf::Vector2<int> dim);
 	void update();
-	void render(sf::RenderWindow& win) const;
+	void render(flfx::DrawList& win) const;
 	void go_up();
 	void go_down();
 	void go_left();
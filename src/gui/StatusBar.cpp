@@ -39,7 +39,7 @@ void StatusBar::update(automa::ServiceProvider& svc, float current) {
 	current_state = filled == size ? BarState::full : current_state;
 	current_state = filled <= 0 ? BarState::empty : current_state;
 }
-void StatusBar::render(sf::RenderWindow& win) {
+void StatusBar::render(flfx::DrawList& win) {
 	win.draw(debug_rects.gone);
 	win.draw(debug_rects.taken);
 	win.draw(debug_rects.filled);
@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "../particle/Gravitator.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -13,7 +14,7 @@ class StatusBar {
 	StatusBar() = default;
 	StatusBar(automa::ServiceProvider& svc, sf::Vector2<int> dim = {8, 2}, float size = 600.f);
 	void update(automa::ServiceProvider& svc, float current);
-	void render(sf::RenderWindow& win);
+	void render(flfx::DrawList& win);
 	BarState current_state{};
 	vfx::Gravitator gravitator{};
 	sf::Sprite sprite{};
@@ -13,7 +13,7 @@ void Widget::update(automa::ServiceProvider& svc, player::Player& player) {
 	gravitator.update(svc);
 	maximum = static_cast<int>(player.health.get_max());
 }
-void Widget::render(sf::RenderWindow& win) {
+void Widget::render(flfx::DrawList& win) {
 	int lookup = static_cast<int>(current_state) * dimensions.x;
 	sprite.setTextureRect(sf::IntRect({{lookup, 0}, dimensions}));
 	draw_position = gravitator.collider.physics.position;
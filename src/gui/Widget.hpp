@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "../particle/Gravitator.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -17,7 +18,7 @@ class Widget {
 	Widget() = default;
 	Widget(automa::ServiceProvider& svc, sf::Vector2<int> dim, int index);
 	void update(automa::ServiceProvider& svc, player::Player& player);
-	void render(sf::RenderWindow& win);
+	void render(flfx::DrawList& win);
 	State current_state{};
 	vfx::Gravitator gravitator{};
 	sf::Sprite sprite{};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace world {
+
+// what an entity type does once its chunk is outside the active radius
+enum class ActivationPolicy { always, reduced, frozen };
+
+// chunk-level simulation activation. entities are bucketed into chunks by position each tick.
+// chunks within active_radius of the focus update every tick, chunks within reduced_radius update every reduced_interval ticks
+// for reduced types, and everything farther is frozen unless its type always updates. reduced entities still integrate
+// their bodies on the ticks in between (see is_reduced), so only their behaviour runs at the lower rate.
+class Activation {
+  public:
+	void update(sf::Vector2<float> focus_position, int current_tick) {
+		focus = get_chunk(focus_position);
+		tick = current_tick;
+	}
+
+	[[nodiscard]] auto get_chunk(sf::Vector2<float> position) const -> sf::Vector2<int> {
+		return {static_cast<int>(std::floor(position.x / chunk_extent)), static_cast<int>(std::floor(position.y / chunk_extent))};
+	}
+
+	[[nodiscard]] auto is_active(sf::Vector2<float> position, ActivationPolicy policy) const -> bool {
+		if (!enabled || policy == ActivationPolicy::always) { return true; }
+		auto const chunk = get_chunk(position);
+		auto const distance = std::max(std::abs(chunk.x - focus.x), std::abs(chunk.y - focus.y));
+		if (distance <= active_radius) { return true; }
+		if (policy == ActivationPolicy::frozen || distance > reduced_radius) { return false; }
+		// stagger reduced chunks so they don't all update on the same tick. chunks left of or above the origin are negative,
+		// and % keeps the sign, so the phase is wrapped into [0, reduced_interval).
+		auto const phase = ((tick + chunk.x + chunk.y * 3) % reduced_interval + reduced_interval) % reduced_interval;
+		return phase == 0;
+	}
+
+	// true for a reduced type in the reduced ring on a tick it doesn't fully update
+	[[nodiscard]] auto is_reduced(sf::Vector2<float> position, ActivationPolicy policy) const -> bool {
+		if (!enabled || policy != ActivationPolicy::reduced) { return false; }
+		auto const chunk = get_chunk(position);
+		auto const distance = std::max(std::abs(chunk.x - focus.x), std::abs(chunk.y - focus.y));
+		return distance > active_radius && distance <= reduced_radius && !is_active(position, policy);
+	}
+
+	bool enabled{true};
+	int active_radius{1};
+	int reduced_radius{2};
+	int reduced_interval{8};
+	float chunk_extent{512.f}; // CHUNK_SIZE cells of 32 pixels
+
+	struct {
+		ActivationPolicy enemies{ActivationPolicy::reduced};
+		ActivationPolicy npcs{ActivationPolicy::reduced};
+		ActivationPolicy chests{ActivationPolicy::frozen};
+		ActivationPolicy animators{ActivationPolicy::frozen};
+		ActivationPolicy inspectables{ActivationPolicy::frozen};
+		ActivationPolicy spawners{ActivationPolicy::frozen};
+		ActivationPolicy breakables{ActivationPolicy::frozen};
+		ActivationPolicy pushables{ActivationPolicy::frozen};
+		ActivationPolicy platforms{ActivationPolicy::always}; // they carry the player and follow fixed tracks
+	} policies{};
+
+  private:
+	sf::Vector2<int> focus{};
+	int tick{};
+};
+
+} // namespace world
@@ -20,7 +20,7 @@ void Breakable::update(automa::ServiceProvider& svc) {
 	if (destroyed()) { return; }
 	energy = std::clamp(energy - dampen, 0.f, std::numeric_limits<float>::max());
 	if (energy < 0.2f) { energy = 0.f; }
-	if (svc.ticker.every_x_ticks(20)) { random_offset = svc.random.random_vector_float(-energy, energy); }
+	if (svc.ticker.every_x_ticks(20)) { random_offset = svc.random.vfx.random_vector_float(-energy, energy); }
 }
 
 void Breakable::handle_collision(shape::Collider& other) const {
@@ -28,7 +28,7 @@ void Breakable::handle_collision(shape::Collider& other) const {
 	other.handle_collider_collision(collider.bounding_box);
 }
 
-void Breakable::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Breakable::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (destroyed()) { return; }
 	sprite.setPosition(collider.physics.position - cam + random_offset);
 	sprite.setTextureRect(sf::IntRect{{style * 32, (state - 1) * 32}, {32, 32}});
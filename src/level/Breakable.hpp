@@ -6,6 +6,7 @@
 #include "../utils/Collider.hpp"
 #include "../utils/Counter.hpp"
 #include "../entities/animation/Animation.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -28,7 +29,7 @@ class Breakable {
 	Breakable(automa::ServiceProvider& svc, sf::Vector2<float> position, int style = 0, int state = 4);
 	void update(automa::ServiceProvider& svc);
 	void handle_collision(shape::Collider& other) const;
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void on_hit(automa::ServiceProvider& svc, world::Map& map, arms::Projectile& proj, int power = 1);
 	void on_smash(automa::ServiceProvider& svc, world::Map& map, int power = 1);
 	void destroy() { state = 0; }
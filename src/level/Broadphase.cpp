@@ -0,0 +1,27 @@
+#include "Broadphase.hpp"
+
+namespace world {
+
+void Broadphase::clear() {
+	for (auto& proxies : bodies) { proxies.clear(); }
+	max_widths = {};
+}
+
+void Broadphase::insert(Body type, std::size_t index, shape::Shape const& box) { insert(type, index, box, box); }
+
+void Broadphase::insert(Body type, std::size_t index, shape::Shape const& box, shape::Shape const& other) {
+	auto& proxies = bodies.at(static_cast<std::size_t>(type));
+	auto left = std::min(box.left(), other.left()) - margin;
+	auto right = std::max(box.right(), other.right()) + margin;
+	proxies.push_back({index, left, std::min(box.top(), other.top()) - margin, right, std::max(box.bottom(), other.bottom()) + margin});
+	auto& max_width = max_widths.at(static_cast<std::size_t>(type));
+	max_width = std::max(max_width, right - left);
+}
+
+void Broadphase::build() {
+	for (auto& proxies : bodies) {
+		std::sort(proxies.begin(), proxies.end(), [](auto const& a, auto const& b) { return a.left < b.left; });
+	}
+}
+
+} // namespace world
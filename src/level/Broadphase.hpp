@@ -0,0 +1,85 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include "../utils/Shape.hpp"
+
+namespace world {
+
+enum class Body { platform, breakable, pushable, switch_block, destroyer, spike, chest, enemy, END };
+
+// sweep-and-prune broadphase for the map's dynamic entities.
+// entities register by type and container index, so the map rebuilds it whenever its containers may have changed.
+// each type keeps its own list sorted by left edge; queries binary search into it and sweep until the right edge.
+// candidates are visited in container order so narrow-phase resolution matches a plain loop over the container.
+// queries reuse the broadphase's own candidate lists, so they belong to the simulation thread.
+class Broadphase {
+  public:
+	struct Proxy {
+		std::size_t index{};
+		float left{};
+		float top{};
+		float right{};
+		float bottom{};
+	};
+
+	void clear();
+	void insert(Body type, std::size_t index, shape::Shape const& box);
+	void insert(Body type, std::size_t index, shape::Shape const& box, shape::Shape const& other);
+	void build();
+
+	template <typename F>
+	void query_aabb(shape::Shape const& region, Body type, F&& fn) const {
+		query(region.left(), region.top(), region.right(), region.bottom(), type, [](Proxy const&) { return true; }, fn);
+	}
+
+	template <typename F>
+	void query_circle(sf::Vector2<float> center, float radius, Body type, F&& fn) const {
+		auto within = [center, radius](Proxy const& proxy) {
+			auto x = std::clamp(center.x, proxy.left, proxy.right) - center.x;
+			auto y = std::clamp(center.y, proxy.top, proxy.bottom) - center.y;
+			return x * x + y * y < radius * radius;
+		};
+		query(center.x - radius, center.y - radius, center.x + radius, center.y + radius, type, within, fn);
+	}
+
+	[[nodiscard]] auto size(Body type) const -> std::size_t { return get_proxies(type).size(); }
+
+	float margin{16.f}; // boxes are fattened so entities that move during a tick are still found
+
+  private:
+	template <typename P, typename F>
+	void query(float left, float top, float right, float bottom, Body type, P&& predicate, F&& fn) const {
+		auto const& proxies = get_proxies(type);
+		auto const reach = max_widths.at(static_cast<std::size_t>(type));
+		auto it = std::lower_bound(proxies.begin(), proxies.end(), left - reach, [](Proxy const& proxy, float edge) { return proxy.left < edge; });
+		// a callback may query again, so each level of nesting has its own list. the lists are indexed rather than
+		// held by reference, since a deeper query can grow scratch and move them.
+		// the nesting level is released on the way out even if fn throws, so later queries don't start one level deep.
+		struct Nesting {
+			std::size_t& depth;
+			~Nesting() { --depth; }
+		};
+		auto const level = depth++;
+		auto const nesting = Nesting{depth};
+		if (scratch.size() <= level) { scratch.emplace_back(); }
+		scratch[level].clear();
+		for (; it != proxies.end() && it->left <= right; ++it) {
+			if (it->right < left || it->bottom < top || it->top > bottom) { continue; }
+			if (predicate(*it)) { scratch[level].push_back(it->index); }
+		}
+		std::sort(scratch[level].begin(), scratch[level].end());
+		for (std::size_t i{0}; i < scratch[level].size(); ++i) { fn(scratch[level][i]); }
+	}
+
+	[[nodiscard]] auto get_proxies(Body type) const -> std::vector<Proxy> const& { return bodies.at(static_cast<std::size_t>(type)); }
+
+	std::array<std::vector<Proxy>, static_cast<std::size_t>(Body::END)> bodies{};
+	std::array<float, static_cast<std::size_t>(Body::END)> max_widths{};
+	mutable std::vector<std::vector<std::size_t>> scratch{}; // candidate lists, one per level of nested queries, kept between queries
+	mutable std::size_t depth{};
+};
+
+} // namespace world
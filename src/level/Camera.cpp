@@ -10,6 +10,7 @@ Camera::Camera() {
 }
 
 void Camera::update(automa::ServiceProvider& svc) {
+	previous_display_position = display_position;
 	screen_dimensions = svc.constants.screen_dimensions;
 	auto screen_dimensions_f = sf::Vector2<float>(screen_dimensions);
 	bounding_box.setSize(screen_dimensions_f);
@@ -31,8 +32,8 @@ void Camera::update(automa::ServiceProvider& svc) {
 			shake.timer.cancel();
 			diff = 0.f;
 		}
-		auto randx = svc.random.random_range_float(-diff, diff);
-		auto randy = svc.random.random_range_float(-diff, diff);
+		auto randx = svc.random.vfx.random_range_float(-diff, diff);
+		auto randy = svc.random.vfx.random_range_float(-diff, diff);
 		display_position = bounding_box.getPosition() + sf::Vector2<float>{randx, randy} + map_bounds_offset;
 	}
 }
@@ -58,6 +59,7 @@ void Camera::set_position(sf::Vector2<float> new_pos) {
 	gravitator.set_position(new_pos);
 	bounding_box.setPosition(new_pos);
 	display_position = new_pos;
+	previous_display_position = new_pos;
 }
 
 void Camera::center(sf::Vector2<float> new_position) {
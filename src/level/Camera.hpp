@@ -38,6 +38,7 @@ class Camera {
 
 	[[nodiscard]] auto get_observed_velocity() const -> sf::Vector2<float> { return observed_velocity; }
 	[[nodiscard]] auto get_position() const -> sf::Vector2<float> { return display_position; }
+	[[nodiscard]] auto get_interpolated_position(float alpha) const -> sf::Vector2<float> { return previous_display_position + (display_position - previous_display_position) * alpha; }
 	[[nodiscard]] auto within_frame(int x, int y) const -> bool { return (x > 0) && (x < screen_dimensions.x + border_buffer) && (y > 0) && (y < screen_dimensions.y + border_buffer); }
 
 	private:
@@ -45,6 +46,7 @@ class Camera {
 	sf::Vector2<int> screen_dimensions{};
 	sf::RectangleShape bounding_box{};
 	sf::Vector2<float> display_position{};
+	sf::Vector2<float> previous_display_position{};
 	sf::Vector2<float> observed_velocity{};
 	sf::Vector2<float> previous_position{};
 	sf::Vector2<float> target{};
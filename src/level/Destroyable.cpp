@@ -28,7 +28,7 @@ void Destroyable::update(automa::ServiceProvider& svc, Map& map, player::Player&
 	for (auto& c : map.chests) { c.get_collider().handle_collider_collision(collider.bounding_box); }
 }
 
-void Destroyable::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Destroyable::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (detonated()) { return; }
 	sprite.setPosition(collider.physics.position - cam);
 	if (svc.greyblock_mode()) {
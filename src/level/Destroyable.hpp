@@ -3,6 +3,7 @@
 #include <string_view>
 #include "../utils/BitFlags.hpp"
 #include "../utils/Collider.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -25,7 +26,7 @@ class Destroyable {
   public:
 	Destroyable(automa::ServiceProvider& svc, sf::Vector2<int> pos, int quest_id, int style_id = 0);
 	void update(automa::ServiceProvider& svc, Map& map, player::Player& player);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void on_hit(automa::ServiceProvider& svc, world::Map& map, arms::Projectile& proj) const;
 	shape::Shape& get_bounding_box();
 	[[nodiscard]] auto detonated() const -> bool { return flags.test(DestroyerState::detonated); }
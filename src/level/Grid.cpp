@@ -3,47 +3,65 @@
 
 namespace world {
 
-Grid::Grid(sf::Vector2<uint32_t> d) : dimensions(d) {
+Grid::Grid(sf::Vector2<uint32_t> d) : dimensions(d), plane(d) {}
+
+void Grid::make_collidable() {
 	cells.clear();
-	for (uint32_t i{0}; i < dimensions.x * dimensions.y; i++) {
-		auto xidx = static_cast<uint32_t>(std::floor(i % dimensions.x));
-		auto yidx = static_cast<uint32_t>(std::floor(i / dimensions.x));
+	slots.assign(size(), -1);
+	auto occupied = std::size_t{};
+	plane.for_each_occupied([this, &occupied](uint32_t i, uint8_t) {
+		slots[i] = 0;
+		++occupied;
+	});
+	cells.reserve(occupied);
+	for (uint32_t i{0}; i < size(); ++i) {
+		if (slots[i] < 0) { continue; }
+		auto xidx = i % dimensions.x;
+		auto yidx = i / dimensions.x;
 		auto xpos = xidx * spacing;
 		auto ypos = yidx * spacing;
-		cells.push_back(Tile({xidx, yidx}, {xpos, ypos}, 0));
-		cells.back().position = sf::Vector2<float>(xpos, ypos);
-		cells.back().scaled_position = sf::Vector2<int>(xidx, yidx); 
+		slots[i] = static_cast<int>(cells.size());
+		cells.push_back(Tile({xidx, yidx}, {xpos, ypos}, plane.get(i)));
+		cells.back().scaled_position = sf::Vector2<int>(xidx, yidx);
 		cells.back().bounding_box.set_position(sf::Vector2<float>(xpos, ypos));
 		cells.back().one_d_index = i;
 	}
-	seed_vertices();
+	collision_revision.reset();
 }
 
 void Grid::check_neighbors() {
-	for (size_t i{0}; i < cells.size(); ++i) {
-		if (cells.at(i).is_occupied()) {
-			bool surrounded{true};
-			auto ui = static_cast<uint32_t>(i);
-			// right neighbor
-			if (!(i == cells.size() - 1)) {
-				if (!cells.at(i + 1).is_solid()) { surrounded = false; }
-				if (cells.at(i + 1).is_big_ramp() && cells.at(i + 1).is_ground_ramp() && !cells.at(i).is_ramp()) { cells.at(i).flags.set(TileState::ramp_adjacent); }
-			}
-			// left neighbor
-			if (!(i == 0)) {
-				if (!cells.at(i - 1).is_solid()) { surrounded = false; }
-				if (cells.at(i - 1).is_big_ramp() && cells.at(i - 1).is_ground_ramp() && !cells.at(i).is_ramp()) { cells.at(i).flags.set(TileState::ramp_adjacent); }
-			}
-			// top neighbor
-			if (!(ui < dimensions.x)) {
-				if (!cells.at(i - dimensions.x).is_solid()) { surrounded = false; }
-			}
-			// bottom neighbor
-			if (!(ui > cells.size() - dimensions.x - 1)) {
-				if (!cells.at(i + dimensions.x).is_solid()) { surrounded = false; }
-			}
-			cells.at(i).surrounded = surrounded;
+	auto solid = [this](uint32_t i) {
+		auto const* tile = find(i);
+		return tile && tile->is_solid();
+	};
+	auto big_ground_ramp = [this](uint32_t i) {
+		auto const* tile = find(i);
+		return tile && tile->is_big_ramp() && tile->is_ground_ramp();
+	};
+	auto const count = static_cast<uint32_t>(size());
+	for (auto& cell : cells) {
+		if (!cell.is_occupied()) { continue; }
+		bool surrounded{true};
+		auto const i = cell.one_d_index;
+		// right neighbor
+		if (!(i == count - 1)) {
+			if (!solid(i + 1)) { surrounded = false; }
+			if (big_ground_ramp(i + 1) && !cell.is_ramp()) { cell.flags.set(TileState::ramp_adjacent); }
+		}
+		// left neighbor
+		if (!(i == 0)) {
+			if (!solid(i - 1)) { surrounded = false; }
+			if (big_ground_ramp(i - 1) && !cell.is_ramp()) { cell.flags.set(TileState::ramp_adjacent); }
+		}
+		// top neighbor
+		if (!(i < dimensions.x)) {
+			if (!solid(i - dimensions.x)) { surrounded = false; }
+		}
+		// bottom neighbor
+		if (!(i > count - dimensions.x - 1)) {
+			if (!solid(i + dimensions.x)) { surrounded = false; }
 		}
+		cell.surrounded = surrounded;
 	}
 }
 
@@ -196,18 +214,209 @@ void Grid::seed_vertices() {
 			break;
 		default: break;
 		}
-		for (int i = 0; i < tile.bounding_box.vertices.size(); i++) {
-			tile.bounding_box.edges[i].x = tile.bounding_box.vertices[(i + 1) % tile.bounding_box.vertices.size()].x - tile.bounding_box.vertices[i].x;
-			tile.bounding_box.edges[i].y = tile.bounding_box.vertices[(i + 1) % tile.bounding_box.vertices.size()].y - tile.bounding_box.vertices[i].y;
-			tile.bounding_box.normals[i] = tile.bounding_box.perp(tile.bounding_box.edges[i]);
-		}
+		update_edges(tile);
+	}
+}
+
+// takes a ramp polygon seed_vertices produced earlier, so a packed level skips the slant table
+void Grid::seed_ramp(uint32_t index, std::array<sf::Vector2<float>, 4> const& vertices, bool big) {
+	auto* found = find(index);
+	if (!found || found->bounding_box.vertices.size() < 4) { return; }
+	auto& tile = *found;
+	for (auto i{0}; i < 4; ++i) { tile.bounding_box.vertices[i] = vertices[i]; }
+	if (big) { tile.flags.set(TileState::big_ramp); }
+	update_edges(tile);
+}
+
+void Grid::update_edges(Tile& tile) {
+	for (int i = 0; i < tile.bounding_box.vertices.size(); i++) {
+		tile.bounding_box.edges[i].x = tile.bounding_box.vertices[(i + 1) % tile.bounding_box.vertices.size()].x - tile.bounding_box.vertices[i].x;
+		tile.bounding_box.edges[i].y = tile.bounding_box.vertices[(i + 1) % tile.bounding_box.vertices.size()].y - tile.bounding_box.vertices[i].y;
+		tile.bounding_box.normals[i] = tile.bounding_box.perp(tile.bounding_box.edges[i]);
 	}
 }
 
 void Grid::destroy_cell(sf::Vector2<int> pos) {
-	for(auto& cell : cells) {
-		if (cell.scaled_position == pos) { cell.value = 0; }
+	if (pos.x < 0 || pos.y < 0 || pos.x >= static_cast<int>(dimensions.x) || pos.y >= static_cast<int>(dimensions.y)) { return; }
+	auto const index = pos.y * dimensions.x + pos.x;
+	plane.set(index, 0);
+	if (auto* tile = find(index)) {
+		tile->value = 0;
+		tile->set_type();
+	}
+	++revision;
+	check_neighbors();
+	calculate_drop_heights(pos.x);
+	if (block_indices.size() != size()) { return; }
+	// re-merge what is left of the block the cell belonged to, then refresh the blocks whose edges were just exposed
+	if (auto block = block_indices.at(index); block >= 0) {
+		auto area = get_block_area(block);
+		release_block(block);
+		merge_blocks(area);
 	}
+	for (auto [x, y] : {std::pair{pos.x - 1, pos.y}, std::pair{pos.x + 1, pos.y}, std::pair{pos.x, pos.y - 1}, std::pair{pos.x, pos.y + 1}}) {
+		if (x < 0 || y < 0 || x >= static_cast<int>(dimensions.x) || y >= static_cast<int>(dimensions.y)) { continue; }
+		if (auto block = block_indices.at(y * dimensions.x + x); block >= 0) { refresh_block(block); }
+	}
+}
+
+void Grid::merge_blocks() {
+	blocks.clear();
+	block_indices.assign(size(), -1);
+	merge_blocks({0, 0, static_cast<int>(dimensions.x), static_cast<int>(dimensions.y)});
+}
+
+void Grid::build_collision() {
+	if (collision_revision == revision) { return; }
+	check_neighbors();
+	calculate_drop_heights();
+	merge_blocks();
+	collision_revision = revision;
+}
+
+void Grid::restore_collision(std::vector<int> drops, std::vector<sf::Rect<int>> const& areas) {
+	drop_heights = std::move(drops);
+	if (drop_heights.size() != size()) { calculate_drop_heights(); }
+	blocks.clear();
+	block_indices.assign(size(), -1);
+	for (auto const& area : areas) { make_block(area); }
+	collision_revision = revision;
+}
+
+auto Grid::get_block_areas() const -> std::vector<sf::Rect<int>> {
+	auto ret = std::vector<sf::Rect<int>>{};
+	for (auto i{0}; i < static_cast<int>(blocks.size()); ++i) {
+		if (blocks.at(i).is_occupied()) { ret.push_back(get_block_area(i)); }
+	}
+	return ret;
+}
+
+// greedy pass in row-major order: grow each run of free solid cells right, then grow the run down while the whole row below matches.
+// single cells are left alone, so isolated tiles collide exactly as before.
+void Grid::merge_blocks(sf::Rect<int> area) {
+	for (auto row{area.top}; row < area.top + area.height; ++row) {
+		for (auto column{area.left}; column < area.left + area.width; ++column) {
+			if (!is_mergeable(column, row)) { continue; }
+			auto width{1};
+			while (column + width < area.left + area.width && is_mergeable(column + width, row)) { ++width; }
+			auto height{1};
+			auto row_fits = [this, column, width](int r) {
+				for (auto c{column}; c < column + width; ++c) {
+					if (!is_mergeable(c, r)) { return false; }
+				}
+				return true;
+			};
+			while (row + height < area.top + area.height && row_fits(row + height)) { ++height; }
+			if (width * height == 1) { continue; }
+			make_block({column, row, width, height});
+		}
+	}
+}
+
+void Grid::make_block(sf::Rect<int> area) {
+	auto const& origin = *find(area.top * dimensions.x + area.left);
+	auto block = Tile(origin.index, origin.position, origin.value);
+	block.scaled_position = origin.scaled_position;
+	block.one_d_index = origin.one_d_index;
+	block.bounding_box = shape::Shape(sf::Vector2<float>(area.width * spacing, area.height * spacing));
+	block.bounding_box.set_position(origin.position);
+	block.drawbox.setSize(block.bounding_box.dimensions);
+	block.flags.set(TileState::merged);
+	for (auto r{area.top}; r < area.top + area.height; ++r) {
+		for (auto c{area.left}; c < area.left + area.width; ++c) { block_indices.at(r * dimensions.x + c) = static_cast<int>(blocks.size()); }
+	}
+	blocks.push_back(block);
+	refresh_block(static_cast<int>(blocks.size()) - 1);
+}
+
+// released blocks stay in place as empty tiles so the indices of other blocks remain valid
+void Grid::release_block(int block) {
+	auto area = get_block_area(block);
+	for (auto row{area.top}; row < area.top + area.height; ++row) {
+		for (auto column{area.left}; column < area.left + area.width; ++column) { block_indices.at(row * dimensions.x + column) = -1; }
+	}
+	blocks.at(block).value = 0;
+}
+
+// a block only needs collision tests if one of its cells is exposed
+void Grid::refresh_block(int block) {
+	auto area = get_block_area(block);
+	auto surrounded{true};
+	for (auto row{area.top}; row < area.top + area.height; ++row) {
+		for (auto column{area.left}; column < area.left + area.width; ++column) {
+			auto const* tile = find(row * dimensions.x + column);
+			surrounded = surrounded && tile && tile->surrounded;
+		}
+	}
+	blocks.at(block).surrounded = surrounded;
+}
+
+// ramp-adjacent cells keep their own bodies so the seam between a ramp and the floor stays guarded
+auto Grid::is_mergeable(int column, int row) const -> bool {
+	auto const* cell = find(row * dimensions.x + column);
+	return cell && cell->is_occupied() && cell->is_solid() && !cell->ramp_adjacent() && block_indices.at(row * dimensions.x + column) < 0;
+}
+
+auto Grid::get_block_area(int block) const -> sf::Rect<int> {
+	auto const& tile = blocks.at(block);
+	return {static_cast<int>(tile.index.x), static_cast<int>(tile.index.y), static_cast<int>(tile.bounding_box.dimensions.x / spacing), static_cast<int>(tile.bounding_box.dimensions.y / spacing)};
+}
+
+// the range is padded by one cell because slanted tiles can have vertices outside their own square
+auto Grid::get_cell_range(shape::Shape const& region) const -> sf::Rect<int> {
+	auto const max_x = static_cast<int>(dimensions.x) - 1;
+	auto const max_y = static_cast<int>(dimensions.y) - 1;
+	auto const left = std::clamp(static_cast<int>(std::floor(region.left() / spacing)) - 1, 0, max_x);
+	auto const right = std::clamp(static_cast<int>(std::floor(region.right() / spacing)) + 1, 0, max_x);
+	auto const top = std::clamp(static_cast<int>(std::floor(region.top() / spacing)) - 1, 0, max_y);
+	auto const bottom = std::clamp(static_cast<int>(std::floor(region.bottom() / spacing)) + 1, 0, max_y);
+	return {left, top, right - left + 1, bottom - top + 1};
+}
+
+void Grid::calculate_drop_heights() {
+	drop_heights.assign(size(), static_cast<int>(dimensions.y));
+	for (int column{0}; column < static_cast<int>(dimensions.x); ++column) { calculate_drop_heights(column); }
+}
+
+void Grid::calculate_drop_heights(int column) {
+	if (drop_heights.size() != size()) { drop_heights.assign(size(), static_cast<int>(dimensions.y)); }
+	if (column < 0 || column >= static_cast<int>(dimensions.x) || dimensions.y == 0) { return; }
+	auto const none = static_cast<int>(dimensions.y);
+	// walk the column bottom-up so each cell reuses the result of the cell beneath it
+	auto below = (dimensions.y - 1) * dimensions.x + column;
+	drop_heights.at(below) = none;
+	for (int row = static_cast<int>(dimensions.y) - 2; row >= 0; --row) {
+		auto index = row * dimensions.x + column;
+		if (plane.get(below) > 0) {
+			drop_heights.at(index) = 1;
+		} else {
+			drop_heights.at(index) = drop_heights.at(below) == none ? none : drop_heights.at(below) + 1;
+		}
+		below = index;
+	}
+}
+
+auto Grid::get_index(sf::Vector2<float> point) const -> std::optional<uint32_t> {
+	if (point.x < 0.f || point.y < 0.f) { return {}; }
+	auto column = static_cast<uint32_t>(point.x / spacing);
+	auto row = static_cast<uint32_t>(point.y / spacing);
+	if (column >= dimensions.x || row >= dimensions.y) { return {}; }
+	return row * dimensions.x + column;
+}
+
+Tile* Grid::get_cell(sf::Vector2<float> point) {
+	auto const index = get_index(point);
+	return index ? find(*index) : nullptr;
+}
+
+auto Grid::memory() const -> Footprint {
+	auto ret = Footprint{};
+	ret.plane = plane.memory();
+	ret.tiles = (cells.capacity() - cells.size()) * sizeof(Tile) + slots.capacity() * sizeof(int);
+	for (auto const& tile : cells) { ret.tiles += tile.memory(); }
+	ret.tables = (blocks.capacity() - blocks.size()) * sizeof(Tile) + (drop_heights.capacity() + block_indices.capacity()) * sizeof(int);
+	for (auto const& tile : blocks) { ret.tables += tile.memory(); }
+	return ret;
 }
 
 } // namespace world
@@ -2,31 +2,161 @@
 #pragma once
 
 #include <stdio.h>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <optional>
 #include <vector>
 #include "../setup/EnumLookups.hpp"
 #include "Tile.hpp"
+#include "TilePlane.hpp"
 
 namespace world {
 
+enum LAYER_ORDER {
+	BACKGROUND = 0,
+	MIDDLEGROUND = 4,
+	FOREGROUND = 7,
+};
+
+int const NUM_LAYERS = 8;
+
 int const CEIL_SLANT_INDEX = 192;
 int const FLOOR_SLANT_INDEX = 208;
 
+// every layer keeps its tile values in a plane. only the collidable layer gets tiles, and only for its occupied cells:
+// make_collidable builds that side table, and everything collision related below works from it.
 class Grid {
   public:
 	Grid() = default;
 	Grid(sf::Vector2<uint32_t> d);
 
 	sf::Vector2<uint32_t> dimensions{};
-	std::vector<Tile> cells{};
+	TilePlane plane{};
+	std::vector<Tile> cells{};		  // side table, row-major. destroyed cells stay in it with a value of zero.
+	std::vector<int> drop_heights{}; // rows from each cell down to the next occupied cell, or dimensions.y if there is none
+	std::vector<Tile> blocks{};		 // maximal rectangles of plain solid cells, so a long floor or wall is one collision body
+	std::vector<int> block_indices{}; // block covering each cell, or -1 if the cell collides on its own
+	uint32_t revision{};			  // bumped whenever cells change at runtime
 
+	// builds the side table from the plane, with square bounding boxes. seed_vertices or seed_ramp shape the ramps afterwards.
+	void make_collidable();
 	void check_neighbors();
 	void seed_vertices();
+	void seed_ramp(uint32_t index, std::array<sf::Vector2<float>, 4> const& vertices, bool big);
 	void destroy_cell(sf::Vector2<int> pos);
+	void calculate_drop_heights();
+	void calculate_drop_heights(int column);
+	void merge_blocks();
+	// neighbour flags, drop heights and blocks together. skipped if they are already current for this revision.
+	void build_collision();
+	// adopts tables an earlier build_collision produced (see data::LevelPack). neighbour flags are expected on the cells already.
+	void restore_collision(std::vector<int> drops, std::vector<sf::Rect<int>> const& areas);
+	[[nodiscard]] auto get_block_areas() const -> std::vector<sf::Rect<int>>;
+	// the side table's tile for a cell, or nullptr if the cell is empty or the grid isn't collidable
+	[[nodiscard]] auto find(uint32_t index) -> Tile* { return index < slots.size() && slots[index] >= 0 ? &cells[slots[index]] : nullptr; }
+	[[nodiscard]] auto find(uint32_t index) const -> Tile const* { return index < slots.size() && slots[index] >= 0 ? &cells[slots[index]] : nullptr; }
+	[[nodiscard]] auto get_index(sf::Vector2<float> point) const -> std::optional<uint32_t>;
+	Tile* get_cell(sf::Vector2<float> point);
+	[[nodiscard]] auto get_position(uint32_t index) const -> sf::Vector2<float> { return {static_cast<float>(index % dimensions.x) * spacing, static_cast<float>(index / dimensions.x) * spacing}; }
+	[[nodiscard]] auto get_drop_height(uint32_t index) const -> int { return index < drop_heights.size() ? drop_heights[index] : static_cast<int>(dimensions.y); }
+	[[nodiscard]] auto size() const -> std::size_t { return plane.size(); }
+	[[nodiscard]] auto is_collidable() const -> bool { return !slots.empty(); }
+	struct Footprint {
+		std::size_t plane{};
+		std::size_t tiles{};  // side table and the index into it
+		std::size_t tables{}; // drop heights and blocks
+		[[nodiscard]] auto total() const -> std::size_t { return plane + tiles + tables; }
+	};
+	[[nodiscard]] auto memory() const -> Footprint;
+
+	// amanatides-woo traversal of the cells crossed by a box that just moved by displacement.
+	// cells are visited in the order the box's center reaches them, padded by the box's half extents, and each cell is visited once.
+	template <typename F>
+	void for_each_cell_along(shape::Shape const& box, sf::Vector2<float> displacement, F&& fn) {
+		if (slots.empty()) { return; }
+		auto const end = box.get_center();
+		auto const start = end - displacement;
+		auto const pad = sf::Vector2<int>{static_cast<int>(std::ceil(box.dimensions.x * 0.5f / spacing)), static_cast<int>(std::ceil(box.dimensions.y * 0.5f / spacing))};
+		auto cell = sf::Vector2<int>{static_cast<int>(std::floor(start.x / spacing)), static_cast<int>(std::floor(start.y / spacing))};
+		auto const last = sf::Vector2<int>{static_cast<int>(std::floor(end.x / spacing)), static_cast<int>(std::floor(end.y / spacing))};
+		auto const step = sf::Vector2<int>{displacement.x > 0.f ? 1 : -1, displacement.y > 0.f ? 1 : -1};
+		auto const infinity = std::numeric_limits<float>::infinity();
+		// parametric distance along the move to the next cell boundary, and between boundaries
+		auto const delta = sf::Vector2<float>{displacement.x != 0.f ? spacing / std::abs(displacement.x) : infinity, displacement.y != 0.f ? spacing / std::abs(displacement.y) : infinity};
+		auto boundary = [this](float origin, int index, int direction, float d) { return d == 0.f ? std::numeric_limits<float>::infinity() : ((index + (direction > 0 ? 1 : 0)) * spacing - origin) / d; };
+		auto next = sf::Vector2<float>{boundary(start.x, cell.x, step.x, displacement.x), boundary(start.y, cell.y, step.y, displacement.y)};
+
+		auto const max_x = static_cast<int>(dimensions.x) - 1;
+		auto const max_y = static_cast<int>(dimensions.y) - 1;
+		auto previous = std::optional<sf::Rect<int>>{};
+		auto const steps = std::abs(last.x - cell.x) + std::abs(last.y - cell.y);
+		for (auto i{0}; i <= steps; ++i) {
+			auto const left = std::clamp(cell.x - pad.x, 0, max_x);
+			auto const right = std::clamp(cell.x + pad.x, 0, max_x);
+			auto const top = std::clamp(cell.y - pad.y, 0, max_y);
+			auto const bottom = std::clamp(cell.y + pad.y, 0, max_y);
+			for (auto row{top}; row <= bottom; ++row) {
+				for (auto column{left}; column <= right; ++column) {
+					if (previous && previous->contains(column, row)) { continue; }
+					if (auto* tile = find(row * dimensions.x + column)) { fn(*tile); }
+				}
+			}
+			previous = sf::Rect<int>{left, top, right - left + 1, bottom - top + 1};
+			if (next.x < next.y) {
+				cell.x += step.x;
+				next.x += delta.x;
+			} else {
+				cell.y += step.y;
+				next.y += delta.y;
+			}
+		}
+	}
+
+	// visits the side table's tiles under a region's bounding rect in row-major order, which matches the order of a full scan.
+	template <typename F>
+	void for_each_cell_in(shape::Shape const& region, F&& fn) {
+		if (slots.empty()) { return; }
+		auto const range = get_cell_range(region);
+		for (auto row{range.top}; row < range.top + range.height; ++row) {
+			for (auto column{range.left}; column < range.left + range.width; ++column) {
+				if (auto* tile = find(row * dimensions.x + column)) { fn(*tile); }
+			}
+		}
+	}
+
+	// like for_each_cell_in, but merged cells are replaced by their block, which is visited once at its first cell in the region.
+	// only collision candidates are visited. nothing is written, so concurrent queries are safe.
+	template <typename F>
+	void for_each_body_in(shape::Shape const& region, F&& fn) {
+		if (slots.empty()) { return; }
+		auto const range = get_cell_range(region);
+		for_each_cell_in(region, [this, &fn, range](Tile& cell) {
+			auto const block = block_indices.empty() ? -1 : block_indices.at(cell.one_d_index);
+			if (block < 0) {
+				if (cell.is_collision_candidate()) { fn(cell); }
+				return;
+			}
+			auto const area = get_block_area(block);
+			if (static_cast<int>(cell.index.x) != std::max(area.left, range.left) || static_cast<int>(cell.index.y) != std::max(area.top, range.top)) { return; }
+			if (blocks.at(block).is_collision_candidate()) { fn(blocks.at(block)); }
+		});
+	}
 
   private:
+	void merge_blocks(sf::Rect<int> area);
+	void make_block(sf::Rect<int> area);
+	static void update_edges(Tile& tile);
+	void release_block(int block);
+	void refresh_block(int block);
+	[[nodiscard]] auto is_mergeable(int column, int row) const -> bool;
+	[[nodiscard]] auto get_block_area(int block) const -> sf::Rect<int>;
+	[[nodiscard]] auto get_cell_range(shape::Shape const& region) const -> sf::Rect<int>;
 	float spacing{32.f};
+	std::vector<int> slots{}; // side table entry for each cell, or -1. empty until make_collidable.
+	std::optional<uint32_t> collision_revision{}; // revision the collision tables were built for
 };
 
 } // namespace squid
@@ -21,175 +21,55 @@ void Map::load(automa::ServiceProvider& svc, int room_number, bool soft) {
 	if (!player->is_dead()) { svc.state_controller.actions.reset(automa::Actions::death_mode); }
 	spawn_counter.start();
 
-	int ctr{};
-	for (auto& room : svc.data.map_jsons) {
-		if (room.id == room_number) { room_lookup = ctr; }
-		++ctr;
-	}
-	auto const& metadata = svc.data.map_jsons.at(room_lookup).metadata;
-	auto const& tiles = svc.data.map_jsons.at(room_lookup).tiles;
-	inspectable_data = svc.data.map_jsons.at(room_lookup).inspectable_data;
-
-	// get npc data
-	auto const& meta = metadata["meta"];
-	room_id = meta["room_id"].as<int>();
-	metagrid_coordinates.x = meta["metagrid"][0].as<int>();
-	metagrid_coordinates.y = meta["metagrid"][1].as<int>();
-	dimensions.x = meta["dimensions"][0].as<int>();
-	dimensions.y = meta["dimensions"][1].as<int>();
-	chunk_dimensions.x = meta["chunk_dimensions"][0].as<int>();
-	chunk_dimensions.y = meta["chunk_dimensions"][1].as<int>();
+	auto const& room = svc.data.room_cache.get(room_number).data;
+	auto const& placements = room.placements;
+	inspectable_data = room.inspectable_data;
+
+	auto const& meta = placements.meta;
+	room_id = meta.room_id;
+	metagrid_coordinates = meta.metagrid;
+	dimensions.x = meta.dimensions.x;
+	dimensions.y = meta.dimensions.y;
+	chunk_dimensions.x = meta.chunk_dimensions.x;
+	chunk_dimensions.y = meta.chunk_dimensions.y;
 	real_dimensions = {(float)dimensions.x * svc.constants.cell_size, (float)dimensions.y * svc.constants.cell_size};
-	// for (int i = 0; i < NUM_LAYERS; ++i) { layers.push_back(Layer(i, (i == MIDDLEGROUND), dimensions)); }
 
 	if (!soft) {
-		if (meta["music"].is_string()) {
-			svc.music.load(meta["music"].as_string());
+		if (!meta.music.empty()) {
+			svc.music.load(meta.music);
 			svc.music.play_looped(10);
 		}
 
-		auto style_value = meta["style"].as<int>();
+		auto style_value = meta.style;
 		style_label = svc.data.map_styles["styles"][style_value]["label"].as_string();
 		style_id = svc.data.map_styles["styles"][style_value]["id"].as<int>();
 		if (svc.greyblock_mode()) { style_id = 20; }
 		native_style_id = svc.data.map_styles["styles"][style_value]["id"].as<int>();
-		background = std::make_unique<bg::Background>(svc, meta["background"].as<int>());
-		styles.breakables = meta["styles"]["breakables"].as<int>();
-		styles.pushables = meta["styles"]["pushables"].as<int>();
-
-		for (auto& entry : metadata["npcs"].array_view()) {
-			sf::Vector2<float> pos{};
-			pos.x = entry["position"][0].as<float>();
-			pos.y = entry["position"][1].as<float>();
-			auto id = entry["id"].as<int>();
-			npcs.push_back(npc::NPC(svc, id));
-			auto npc_state = svc.quest.get_progression(fornani::QuestType::npc, id);
-			for (auto& convo : entry["suites"][npc_state].array_view()) { npcs.back().push_conversation(convo.as_string()); }
-			npcs.back().set_position_from_scaled(pos);
-			if ((bool)entry["background"].as_bool()) { npcs.back().push_to_background(); }
-		}
-		for (auto& entry : metadata["chests"].array_view()) {
-			sf::Vector2<float> pos{};
-			pos.x = entry["position"][0].as<float>();
-			pos.y = entry["position"][1].as<float>();
-			chests.push_back(entity::Chest(svc, entry["id"].as<int>()));
-			chests.back().set_item(entry["item_id"].as<int>());
-			chests.back().set_amount(entry["amount"].as<int>());
-			chests.back().set_rarity(entry["rarity"].as<float>());
-			if (entry["type"].as<int>() == 1) { chests.back().set_type(entity::ChestType::gun); }
-			if (entry["type"].as<int>() == 2) { chests.back().set_type(entity::ChestType::orbs); }
-			if (entry["type"].as<int>() == 3) { chests.back().set_type(entity::ChestType::item); }
-			chests.back().set_position_from_scaled(pos);
-		}
-
-		for (auto& entry : metadata["animators"].array_view()) {
-			sf::Vector2<int> scaled_dim{};
-			sf::Vector2<int> scaled_pos{};
-			scaled_pos.x = entry["position"][0].as<int>();
-			scaled_pos.y = entry["position"][1].as<int>();
-			scaled_dim.x = entry["dimensions"][0].as<int>();
-			scaled_dim.y = entry["dimensions"][1].as<int>();
-			auto automatic = (bool)entry["automatic"].as_bool();
-			auto astyle = (bool)entry["style"].as<int>();
-			auto lg = scaled_dim.x == 2;
-			auto foreground = (bool)entry["foreground"].as_bool();
-			auto aid = entry["id"].as<int>();
-			auto a = entity::Animator(svc, scaled_pos, aid, lg, automatic, foreground, astyle);
-			animators.push_back(a);
-		}
-		for (auto& entry : metadata["beds"].array_view()) {
-			sf::Vector2<float> pos{};
-			pos.x = entry["position"][0].as<float>() * svc.constants.cell_size;
-			pos.y = entry["position"][1].as<float>() * svc.constants.cell_size;
-			beds.push_back(entity::Bed(svc, pos));
-		}
-		for (auto& entry : metadata["inspectables"].array_view()) {
-			sf::Vector2<uint32_t> dim{};
-			sf::Vector2<uint32_t> pos{};
-			auto key = entry["key"].as_string();
-			pos.x = entry["position"][0].as<int>();
-			pos.y = entry["position"][1].as<int>();
-			dim.x = entry["dimensions"][0].as<int>();
-			dim.y = entry["dimensions"][1].as<int>();
-			auto alt = entry["alternates"].as<int>();
-			auto native = entry["native_id"].as<int>();
-			auto aoc = static_cast<bool>(entry["activate_on_contact"].as_bool());
-			inspectables.push_back(entity::Inspectable(svc, dim, pos, key, room_id, alt, native, aoc));
-			if (svc.data.inspectable_is_destroyed(inspectables.back().get_id())) { inspectables.back().destroy(); }
-		}
-
-		for (auto& entry : metadata["enemies"].array_view()) {
-			int id{};
-			sf::Vector2<int> pos{};
-			pos.x = entry["position"][0].as<int>();
-			pos.y = entry["position"][1].as<int>();
-			enemy_catalog.push_enemy(svc, *this, *m_console, entry["id"].as<int>());
-			enemy_catalog.enemies.back()->set_position({(float)(pos.x * svc.constants.cell_size), (float)(pos.y * svc.constants.cell_size)});
-			enemy_catalog.enemies.back()->get_collider().physics.zero();
-		}
-		for (auto& entry : metadata["destroyers"].array_view()) {
-			sf::Vector2<int> pos{};
-			pos.x = entry["position"][0].as<int>();
-			pos.y = entry["position"][1].as<int>();
-			auto quest_id = entry["quest_id"].as<int>();
-			destroyers.push_back(Destroyable(svc, pos, quest_id));
-		}
+		background = std::make_unique<bg::Background>(svc, meta.background);
+		styles.breakables = meta.breakables;
+		styles.pushables = meta.pushables;
 	}
 
-	for (auto& entry : metadata["portals"].array_view()) {
-		sf::Vector2<uint32_t> pos{};
-		sf::Vector2<uint32_t> dim{};
-		pos.x = entry["position"][0].as<int>();
-		pos.y = entry["position"][1].as<int>();
-		dim.x = entry["dimensions"][0].as<int>();
-		dim.y = entry["dimensions"][1].as<int>();
-		auto src_id = entry["source_id"].as<int>();
-		auto dest_id = entry["destination_id"].as<int>();
-		auto aoc = (bool)entry["activate_on_contact"].as_bool();
-		auto locked = (bool)entry["locked"].as_bool();
-		auto key_id = entry["key_id"].as<int>();
-		portals.push_back(entity::Portal(svc, dim, pos, src_id, dest_id, aoc, locked, key_id));
+	if (!soft) { populate(svc); }
+
+	for (auto const& entry : placements.portals) {
+		auto const dim = sf::Vector2<uint32_t>{entry.dimensions};
+		auto const pos = sf::Vector2<uint32_t>{entry.position};
+		portals.push_back(entity::Portal(svc, dim, pos, entry.source_id, entry.destination_id, entry.activate_on_contact, entry.locked, entry.key_id));
 		portals.back().update(svc);
 	}
 
-	auto const& savept = metadata["save_point"];
-	auto save_id = svc.state_controller.save_point_id;
-	save_point.id = savept.contains("position") ? room_id : -1;
-	save_point.scaled_position.x = savept["position"][0].as<int>();
-	save_point.scaled_position.y = savept["position"][1].as<int>();
-
-	for (auto& entry : metadata["platforms"].array_view()) {
-		sf::Vector2<float> dim{};
-		sf::Vector2<float> pos{};
-		pos.x = entry["position"][0].as<float>();
-		pos.y = entry["position"][1].as<float>();
-		dim.x = entry["dimensions"][0].as<float>();
-		dim.y = entry["dimensions"][1].as<float>();
-		pos *= svc.constants.cell_size;
-		dim *= svc.constants.cell_size;
-		auto start = entry["start"].as<float>();
-		start = std::clamp(start, 0.f, 1.f);
-		auto type = entry["type"].as_string();
-		platforms.push_back(Platform(svc, pos, dim, entry["extent"].as<float>(), type, start, entry["style"].as<int>()));
-	}
-	for (auto& entry : metadata["switch_blocks"].array_view()) {
-		sf::Vector2<float> pos{};
-		pos.x = entry["position"][0].as<float>();
-		pos.y = entry["position"][1].as<float>();
-		pos *= svc.constants.cell_size;
-		auto type = entry["type"].as<int>();
-		auto button_id = entry["button_id"].as<int>();
-		switch_blocks.push_back(SwitchBlock(svc, pos, button_id, type));
-	}
-	for (auto& entry : metadata["switches"].array_view()) {
-		sf::Vector2<float> pos{};
-		pos.x = entry["position"][0].as<float>();
-		pos.y = entry["position"][1].as<float>();
-		pos *= svc.constants.cell_size;
-		auto type = entry["type"].as<int>();
-		auto button_id = entry["button_id"].as<int>();
-		switch_buttons.push_back(std::make_unique<SwitchButton>(svc, pos, button_id, type, *this));
+	save_point.id = placements.save_point ? room_id : -1;
+	save_point.scaled_position = sf::Vector2<uint32_t>{placements.save_point.value_or(sf::Vector2<int>{})};
+
+	for (auto const& entry : placements.platforms) {
+		auto pos = entry.position * svc.constants.cell_size;
+		auto dim = entry.dimensions * svc.constants.cell_size;
+		auto start = std::clamp(entry.start, 0.f, 1.f);
+		platforms.push_back(Platform(svc, pos, dim, entry.extent, entry.type, start, entry.style));
 	}
+	for (auto const& entry : placements.switch_blocks) { switch_blocks.push_back(SwitchBlock(svc, entry.position * svc.constants.cell_size, entry.button_id, entry.type)); }
+	for (auto const& entry : placements.switches) { switch_buttons.push_back(std::make_unique<SwitchButton>(svc, entry.position * svc.constants.cell_size, entry.button_id, entry.type, *this)); }
 
 	generate_collidable_layer();
 	if (!soft) {
@@ -202,8 +82,50 @@ void Map::load(automa::ServiceProvider& svc, int room_number, bool soft) {
 	}
 }
 
+// builds the room's residents from its placements
+void Map::populate(automa::ServiceProvider& svc) {
+	auto const& placements = svc.data.room_cache.get(room_id).data.placements;
+	for (auto const& entry : placements.npcs) {
+		npcs.push_back(npc::NPC(svc, entry.id));
+		auto npc_state = svc.quest.get_progression(fornani::QuestType::npc, entry.id);
+		if (npc_state >= 0 && npc_state < static_cast<int>(entry.suites.size())) {
+			for (auto const& convo : entry.suites.at(npc_state)) { npcs.back().push_conversation(convo); }
+		}
+		npcs.back().set_position_from_scaled(entry.position);
+		if (entry.background) { npcs.back().push_to_background(); }
+	}
+	for (auto const& entry : placements.chests) {
+		chests.push_back(entity::Chest(svc, entry.id));
+		chests.back().set_item(entry.item_id);
+		chests.back().set_amount(entry.amount);
+		chests.back().set_rarity(entry.rarity);
+		if (entry.type == 1) { chests.back().set_type(entity::ChestType::gun); }
+		if (entry.type == 2) { chests.back().set_type(entity::ChestType::orbs); }
+		if (entry.type == 3) { chests.back().set_type(entity::ChestType::item); }
+		chests.back().set_position_from_scaled(entry.position);
+	}
+
+	for (auto const& entry : placements.animators) {
+		auto lg = entry.dimensions.x == 2;
+		animators.push_back(entity::Animator(svc, entry.position, entry.id, lg, entry.automatic, entry.foreground, static_cast<bool>(entry.style)));
+	}
+	for (auto const& entry : placements.beds) { beds.push_back(entity::Bed(svc, entry * svc.constants.cell_size)); }
+	for (auto const& entry : placements.inspectables) {
+		auto const dim = sf::Vector2<uint32_t>{entry.dimensions};
+		auto const pos = sf::Vector2<uint32_t>{entry.position};
+		inspectables.push_back(entity::Inspectable(svc, dim, pos, entry.key, room_id, entry.alternates, entry.native_id, entry.activate_on_contact));
+		if (svc.data.inspectable_is_destroyed(inspectables.back().get_id())) { inspectables.back().destroy(); }
+	}
+
+	for (auto const& entry : placements.enemies) {
+		enemy_catalog.push_enemy(svc, *this, *m_console, entry.id);
+		enemy_catalog.enemies.back()->set_position({(float)(entry.position.x * svc.constants.cell_size), (float)(entry.position.y * svc.constants.cell_size)});
+		enemy_catalog.enemies.back()->get_collider().physics.zero();
+	}
+	for (auto const& entry : placements.destroyers) { destroyers.push_back(Destroyable(svc, entry.position, entry.quest_id)); }
+}
+
 void Map::update(automa::ServiceProvider& svc, gui::Console& console, gui::InventoryWindow& inventory_window) {
-	auto& layers = svc.data.get_layers(room_id);
 	loading.update();
 	if (loading.running()) { generate_layer_textures(svc); } // band-aid fix for weird artifacting for 1x1 levels
 	flags.state.reset(LevelState::camera_shake);
@@ -219,6 +141,13 @@ void Map::update(automa::ServiceProvider& svc, gui::Console& console, gui::Inven
 		flags.state.reset(LevelState::spawn_enemy);
 	}
 
+	update_broadphase();
+	activation.update(player->collider.physics.position, svc.ticker.ticks);
+	if (auto revision = get_layers().at(MIDDLEGROUND).grid.revision; revision != tile_revision) {
+		tile_revision = revision;
+		wake_bodies();
+	}
+
 	console.update(svc);
 	inventory_window.update(svc, *player, *this);
 
@@ -236,8 +165,14 @@ void Map::update(automa::ServiceProvider& svc, gui::Console& console, gui::Inven
 			grenade.physics.velocity *= -1.f;
 		}
 		if (grenade.detonated() && grenade.sensor.within_bounds(player->hurtbox)) { player->hurt(grenade.get_damage()); }
-		for (auto& enemy : enemy_catalog.enemies) {
-			if (grenade.detonated() && grenade.sensor.within_bounds(enemy->get_collider().hurtbox)) {
+		if (!grenade.detonated()) { continue; }
+		broadphase.query_circle(grenade.sensor.bounds.getPosition(), grenade.sensor.bounds.getRadius(), Body::breakable, [this, &grenade](std::size_t index) {
+			auto& breakable = breakables.at(index);
+			if (grenade.sensor.within_bounds(breakable.get_bounding_box())) { breakable.destroy(); }
+		});
+		broadphase.query_circle(grenade.sensor.bounds.getPosition(), grenade.sensor.bounds.getRadius(), Body::enemy, [this, &svc, &grenade](std::size_t index) {
+			auto& enemy = enemy_catalog.enemies.at(index);
+			if (grenade.sensor.within_bounds(enemy->get_collider().hurtbox)) {
 				enemy->hurt();
 				enemy->health.inflict(grenade.get_damage());
 				enemy->health_indicator.add(grenade.get_damage());
@@ -247,62 +182,28 @@ void Map::update(automa::ServiceProvider& svc, gui::Console& console, gui::Inven
 					svc.soundboard.flags.frdog.set(audio::Frdog::death);
 				}
 			}
-		}
+		});
 	}
 
-	// i need to refactor this...
-	for (auto& index : collidable_indeces) {
-		auto& cell = layers.at(MIDDLEGROUND).grid.cells.at(index);
-		// damage player if spikes
+	// damage player if spikes
+	for_each_collidable_cell(player->collider.hurtbox, [this](Tile& cell) {
 		if (cell.is_spike() && player->collider.hurtbox.overlaps(cell.bounding_box)) { player->hurt(1); }
 		if (cell.is_death_spike() && player->collider.hurtbox.overlaps(cell.bounding_box)) { player->hurt(64); }
+	});
 
-		for (auto& grenade : active_grenades) {
-			for (auto& breakable : breakables) {
-				if (grenade.detonated() && grenade.sensor.within_bounds(breakable.get_bounding_box())) { breakable.destroy(); }
-			}
-		}
-		for (auto& proj : active_projectiles) {
-
-			// should be, simply:
-			// cell.update(svc, player, proj, *this);
-			// or something similar
-
-			if (!nearby(cell.bounding_box, proj.bounding_box)) {
-				continue;
-			} else {
-				cell.collision_check = true;
-				if ((proj.bounding_box.overlaps(cell.bounding_box) && cell.is_occupied())) {
-					if (!cell.is_collidable()) { continue; }
-					if (!proj.stats.transcendent) {
-						if (!proj.destruction_initiated()) {
-							effects.push_back(entity::Effect(svc, proj.destruction_point + proj.physics.position, {}, proj.effect_type(), 2));
-							if (proj.direction.lr == dir::LR::neutral) { effects.back().rotate(); }
-						}
-						proj.destroy(false);
-					}
-					if (proj.stats.spring && cell.is_hookable()) {
-						if (proj.hook.grapple_flags.test(arms::GrappleState::probing)) {
-							proj.hook.spring.set_anchor(cell.middle_point());
-							proj.hook.grapple_triggers.set(arms::GrappleTriggers::found);
-						}
-						handle_grappling_hook(svc, proj);
-					}
-				}
-			}
-		}
-	}
+	for (auto& proj : active_projectiles) { handle_cell_collision(svc, proj); }
 
 	manage_projectiles(svc);
+	update_broadphase(); // breakables and destroyers may have just been erased
 
 	for (auto& proj : active_projectiles) {
 		if (proj.state.test(arms::ProjectileState::destruction_initiated)) { continue; }
-		for (auto& platform : platforms) { platform.on_hit(svc, *this, proj); }
-		for (auto& breakable : breakables) { breakable.on_hit(svc, *this, proj); }
-		for (auto& pushable : pushables) { pushable.on_hit(svc, *this, proj); }
-		for (auto& destroyer : destroyers) { destroyer.on_hit(svc, *this, proj); }
-		for (auto& block : switch_blocks) { block.on_hit(svc, *this, proj); }
-		for (auto& enemy : enemy_catalog.enemies) { enemy->on_hit(svc, *this, proj); }
+		broadphase.query_aabb(proj.bounding_box, Body::platform, [this, &svc, &proj](std::size_t index) { platforms.at(index).on_hit(svc, *this, proj); });
+		broadphase.query_aabb(proj.bounding_box, Body::breakable, [this, &svc, &proj](std::size_t index) { breakables.at(index).on_hit(svc, *this, proj); });
+		broadphase.query_aabb(proj.bounding_box, Body::pushable, [this, &svc, &proj](std::size_t index) { pushables.at(index).on_hit(svc, *this, proj); });
+		broadphase.query_aabb(proj.bounding_box, Body::destroyer, [this, &svc, &proj](std::size_t index) { destroyers.at(index).on_hit(svc, *this, proj); });
+		broadphase.query_aabb(proj.bounding_box, Body::switch_block, [this, &svc, &proj](std::size_t index) { switch_blocks.at(index).on_hit(svc, *this, proj); });
+		broadphase.query_aabb(proj.bounding_box, Body::enemy, [this, &svc, &proj](std::size_t index) { enemy_catalog.enemies.at(index)->on_hit(svc, *this, proj); });
 
 		if (player->shielding() && player->controller.get_shield().sensor.within_bounds(proj.bounding_box)) { player->controller.get_shield().damage(proj.stats.base_damage * player->player_stats.shield_dampen); }
 		if (proj.bounding_box.overlaps(player->hurtbox) && proj.team != arms::TEAMS::NANI) {
@@ -311,30 +212,54 @@ void Map::update(automa::ServiceProvider& svc, gui::Console& console, gui::Inven
 		}
 	}
 	for (auto& enemy : enemy_catalog.enemies) {
-		enemy->unique_update(svc, *this, *player);
-		enemy->post_update(svc, *this, *player);
+		auto const position = enemy->get_collider().physics.position;
+		if (activation.is_active(position, activation.policies.enemies)) {
+			enemy->unique_update(svc, *this, *player);
+			enemy->post_update(svc, *this, *player);
+		} else if (activation.is_reduced(position, activation.policies.enemies)) {
+			enemy->integrate(svc, *this);
+		}
 	}
 
 	for (auto& loot : active_loot) { loot.update(svc, *this, *player); }
 	for (auto& grenade : active_grenades) { grenade.update(svc, *player, *this); }
-	for (auto& emitter : active_emitters) { emitter.update(svc, *this); }
-	for (auto& chest : chests) { chest.update(svc, *this, console, *player); }
-	for (auto& npc : npcs) { npc.update(svc, *this, console, *player); }
+	update_emitters(svc);
+	for (auto& chest : chests) {
+		if (activation.is_active(chest.get_collider().physics.position, activation.policies.chests)) { chest.update(svc, *this, console, *player); }
+	}
+	for (auto& npc : npcs) {
+		if (activation.is_active(npc.get_position(), activation.policies.npcs)) {
+			npc.update(svc, *this, console, *player);
+		} else if (activation.is_reduced(npc.get_position(), activation.policies.npcs)) {
+			npc.integrate(svc, *this);
+		}
+	}
 	for (auto& portal : portals) { portal.handle_activation(svc, *player, console, room_id, transition.fade_out, transition.done); }
-	for (auto& inspectable : inspectables) { inspectable.update(svc, *player, console, inspectable_data); }
-	for (auto& animator : animators) { animator.update(svc, *player); }
+	for (auto& inspectable : inspectables) {
+		if (activation.is_active(inspectable.position, activation.policies.inspectables)) { inspectable.update(svc, *player, console, inspectable_data); }
+	}
+	for (auto& animator : animators) {
+		if (activation.is_active(animator.position, activation.policies.animators)) { animator.update(svc, *player); }
+	}
 	for (auto& effect : effects) { effect.update(svc, *this); }
-	for (auto& platform : platforms) { platform.update(svc, *this, *player); }
-	for (auto& spawner : spawners) { spawner.update(svc, *this); }
+	for (auto& platform : platforms) {
+		if (activation.is_active(platform.bounding_box.position, activation.policies.platforms)) { platform.update(svc, *this, *player); }
+	}
+	for (auto& spawner : spawners) {
+		if (activation.is_active(spawner.get_position(), activation.policies.spawners)) { spawner.update(svc, *this); }
+	}
 	for (auto& switch_block : switch_blocks) { switch_block.update(svc, *this, *player); }
 	for (auto& switch_button : switch_buttons) { switch_button->update(svc, *this, *player); }
 	for (auto& destroyer : destroyers) { destroyer.update(svc, *this, *player); }
 	for (auto& bed : beds) { bed.update(svc, *this, console, *player); }
 	for (auto& breakable : breakables) {
+		if (!activation.is_active(breakable.get_bounding_box().position, activation.policies.breakables)) { continue; }
 		breakable.update(svc);
 		breakable.handle_collision(player->collider);
 	}
-	for (auto& pushable : pushables) { pushable.update(svc, *this, *player); }
+	for (auto& pushable : pushables) {
+		if (activation.is_active(pushable.collider.physics.position, activation.policies.pushables)) { pushable.update(svc, *this, *player); }
+	}
 	for (auto& spike : spikes) { spike.handle_collision(player->collider); }
 	player->collider.detect_map_collision(*this);
 	transition.update(*player);
@@ -384,7 +309,7 @@ void Map::update(automa::ServiceProvider& svc, gui::Console& console, gui::Inven
 			player->health.heal(64.f);
 			player->health.update();
 			svc.soundboard.flags.item.set(audio::Item::heal);
-			svc.music.load(svc.data.map_jsons.at(room_lookup).metadata["meta"]["music"].as_string());
+			svc.music.load(svc.data.room_cache.get(room_id).data.placements.meta.music);
 			svc.music.play_looped(10);
 			transition.fade_in = true;
 			svc.state_controller.actions.reset(automa::Actions::console_transition);
@@ -396,7 +321,7 @@ void Map::update(automa::ServiceProvider& svc, gui::Console& console, gui::Inven
 	inventory_window.info.clean_off_trigger();
 }
 
-void Map::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Map::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	auto& layers = svc.data.get_layers(room_id);
 	// check for a switch to greyblock mode
 	if (svc.debug_flags.test(automa::DebugFlags::greyblock_trigger)) {
@@ -457,10 +382,11 @@ void Map::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector
 
 	if (svc.greyblock_mode()) {
 		for (auto& index : collidable_indeces) {
-			auto& cell = layers.at(MIDDLEGROUND).grid.cells.at(index);
-			cell.drawbox.setPosition(cell.position - cam);
-			if (cell.ramp_adjacent()) { cell.drawbox.setOutlineColor(sf::Color::Red); }
-			win.draw(cell.drawbox);
+			auto* cell = layers.at(MIDDLEGROUND).grid.find(index);
+			if (!cell) { continue; }
+			cell->drawbox.setPosition(cell->position - cam);
+			if (cell->ramp_adjacent()) { cell->drawbox.setOutlineColor(sf::Color::Red); }
+			win.draw(cell->drawbox);
 		}
 	}
 
@@ -506,7 +432,7 @@ void Map::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector
 	}
 }
 
-void Map::render_background(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Map::render_background(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (!svc.greyblock_mode()) {
 		background->render(svc, win, cam, real_dimensions);
 		for (int i = 0; i < 4; ++i) {
@@ -533,7 +459,7 @@ void Map::render_background(automa::ServiceProvider& svc, sf::RenderWindow& win,
 	}
 }
 
-void Map::render_console(automa::ServiceProvider& svc, gui::Console& console, sf::RenderWindow& win) {
+void Map::render_console(automa::ServiceProvider& svc, gui::Console& console, flfx::DrawList& win) {
 	if (console.flags.test(gui::ConsoleFlags::active)) { console.render(win); }
 	console.write(win, false);
 }
@@ -569,7 +495,7 @@ void Map::manage_projectiles(automa::ServiceProvider& svc) {
 			proj.state.set(arms::ProjectileState::poof);
 		}
 	}
-	for (auto& emitter : active_emitters) { emitter.update(svc, *this); }
+	update_emitters(svc);
 
 	std::erase_if(active_projectiles, [](auto const& p) { return p.state.test(arms::ProjectileState::destroyed); });
 	std::erase_if(active_grenades, [](auto const& g) { return g.detonated(); });
@@ -593,9 +519,9 @@ void Map::manage_projectiles(automa::ServiceProvider& svc) {
 void Map::generate_collidable_layer(bool live) {
 	auto& layers = m_services->data.get_layers(room_id);
 	auto pushable_offset = sf::Vector2<float>{1.f, 0.f};
-	layers.at(MIDDLEGROUND).grid.check_neighbors();
+	layers.at(MIDDLEGROUND).grid.build_collision();
 	for (auto& cell : layers.at(MIDDLEGROUND).grid.cells) {
-		if ((!cell.surrounded && cell.is_occupied() && !cell.is_special())) { collidable_indeces.push_back(cell.one_d_index); }
+		if (cell.is_collision_candidate()) { collidable_indeces.push_back(cell.one_d_index); }
 		if (live) { continue; }
 		if (cell.is_breakable()) { breakables.push_back(Breakable(*m_services, cell.position, styles.breakables)); }
 		if (cell.is_pushable()) { pushables.push_back(Pushable(*m_services, cell.position + pushable_offset, styles.pushables, cell.value - 227)); }
@@ -604,42 +530,118 @@ void Map::generate_collidable_layer(bool live) {
 	}
 }
 
+// emission draws random numbers, so it stays serial and in order. integration only reads the tiles and writes each emitter's own particles,
+// but a job costs more than a handful of particles, so it only goes wide once there are enough of them to split.
+void Map::update_emitters(automa::ServiceProvider& svc) {
+	auto particles = std::size_t{};
+	for (auto& emitter : active_emitters) {
+		emitter.emit(svc);
+		particles += emitter.size();
+	}
+	if (particles < parallel_particles) {
+		for (auto& emitter : active_emitters) { emitter.integrate(svc, *this); }
+		return;
+	}
+	svc.jobs.parallel_for(active_emitters.size(), [this, &svc](std::size_t i) { active_emitters[i].integrate(svc, *this); }, 1);
+}
+
+void Map::update_broadphase() {
+	broadphase.clear();
+	for (std::size_t i{0}; i < platforms.size(); ++i) { broadphase.insert(Body::platform, i, platforms[i].bounding_box); }
+	for (std::size_t i{0}; i < breakables.size(); ++i) { broadphase.insert(Body::breakable, i, breakables[i].get_bounding_box()); }
+	for (std::size_t i{0}; i < pushables.size(); ++i) { broadphase.insert(Body::pushable, i, pushables[i].collider.bounding_box, pushables[i].collider.jumpbox); }
+	for (std::size_t i{0}; i < switch_blocks.size(); ++i) { broadphase.insert(Body::switch_block, i, switch_blocks[i].get_bounding_box()); }
+	for (std::size_t i{0}; i < destroyers.size(); ++i) { broadphase.insert(Body::destroyer, i, destroyers[i].get_bounding_box()); }
+	for (std::size_t i{0}; i < spikes.size(); ++i) { broadphase.insert(Body::spike, i, spikes[i].get_bounding_box()); }
+	for (std::size_t i{0}; i < chests.size(); ++i) { broadphase.insert(Body::chest, i, chests[i].get_collider().bounding_box, chests[i].get_jumpbox()); }
+	for (std::size_t i{0}; i < enemy_catalog.enemies.size(); ++i) {
+		auto& enemy = enemy_catalog.enemies[i];
+		broadphase.insert(Body::enemy, i, enemy->get_collider().bounding_box, enemy->get_secondary_collider().bounding_box);
+	}
+	broadphase.build();
+}
+
+void Map::wake_bodies() {
+	for (auto& pushable : pushables) { pushable.collider.wake(); }
+	for (auto& loot : active_loot) { loot.wake(); }
+	for (auto& enemy : enemy_catalog.enemies) { enemy->get_collider().wake(); }
+}
+
+// sleeping bodies stay asleep until something that could push, carry or support them is nearby
+bool Map::is_disturbed(shape::Collider const& body) {
+	if (player->collider.bounding_box.overlaps(body.vicinity)) { return true; }
+	auto disturbed{false};
+	for (auto type : {Body::platform, Body::breakable, Body::switch_block, Body::destroyer}) {
+		broadphase.query_aabb(body.vicinity, type, [&disturbed](std::size_t) { disturbed = true; });
+	}
+	broadphase.query_aabb(body.vicinity, Body::pushable, [this, &body, &disturbed](std::size_t index) {
+		auto const& other = pushables.at(index).collider;
+		if (&other != &body && !other.asleep()) { disturbed = true; }
+	});
+	broadphase.query_aabb(body.vicinity, Body::enemy, [this, &disturbed](std::size_t index) {
+		if (!enemy_catalog.enemies.at(index)->died()) { disturbed = true; }
+	});
+	return disturbed;
+}
+
 void Map::generate_layer_textures(automa::ServiceProvider& svc) {
+	if (svc.headless()) { return; } // render textures need a graphics context
 	auto& layers = svc.data.get_layers(room_id);
 	for (auto& layer : layers) {
 		layer_textures.at((int)layer.render_order).create(layer.grid.dimensions.x * svc.constants.i_cell_size, layer.grid.dimensions.y * svc.constants.i_cell_size);
 		layer_textures.at((int)layer.render_order).clear(sf::Color::Transparent);
-		for (auto& cell : layer.grid.cells) {
-			if (cell.is_occupied() && !cell.is_special()) {
-				auto x_coord = static_cast<int>((cell.value % svc.constants.tileset_scaled.x) * svc.constants.i_cell_size);
-				auto y_coord = static_cast<int>(std::floor(cell.value / svc.constants.tileset_scaled.x) * svc.constants.i_cell_size);
-				tile_sprite.setTexture(svc.assets.tilesets.at(style_id));
-				tile_sprite.setTextureRect(sf::IntRect({x_coord, y_coord}, {svc.constants.i_cell_size, svc.constants.i_cell_size}));
-				tile_sprite.setPosition(cell.position);
-				layer_textures.at((int)layer.render_order).draw(tile_sprite);
-			}
-		}
+		layer.grid.plane.for_each_occupied([&](uint32_t index, uint8_t value) {
+			auto const type = Tile::get_type(value);
+			if (type == TileType::pushable || type == TileType::breakable) { return; }
+			auto x_coord = static_cast<int>((value % svc.constants.tileset_scaled.x) * svc.constants.i_cell_size);
+			auto y_coord = static_cast<int>(std::floor(value / svc.constants.tileset_scaled.x) * svc.constants.i_cell_size);
+			tile_sprite.setTexture(svc.assets.tilesets.at(style_id));
+			tile_sprite.setTextureRect(sf::IntRect({x_coord, y_coord}, {svc.constants.i_cell_size, svc.constants.i_cell_size}));
+			tile_sprite.setPosition(layer.grid.get_position(index));
+			layer_textures.at((int)layer.render_order).draw(tile_sprite);
+		});
 	}
 }
 
 bool Map::check_cell_collision(shape::Collider collider) {
-	auto& layers = m_services->data.get_layers(room_id);
-	for (auto& index : collidable_indeces) {
-		auto& cell = layers.at(MIDDLEGROUND).grid.cells.at(index);
-		if (!nearby(cell.bounding_box, collider.bounding_box)) {
-			continue;
-		} else {
-			// check vicinity so we can escape early
-			if (!collider.vicinity.overlaps(cell.bounding_box)) {
-				continue;
-			} else if (!cell.is_solid()) {
-				continue;
-			} else {
-				if (cell.value > 0 && collider.predictive_combined.SAT(cell.bounding_box)) { return true; }
-			}
+	auto ret{false};
+	for_each_collidable_cell(collider.vicinity, [this, &collider, &ret](Tile& cell) {
+		if (ret || (!cell.is_merged() && !nearby(cell.bounding_box, collider.bounding_box))) { return; }
+		// check vicinity so we can escape early
+		if (!collider.vicinity.overlaps(cell.bounding_box) || !cell.is_solid()) { return; }
+		if (cell.value > 0 && collider.predictive_combined.SAT(cell.bounding_box)) { ret = true; }
+	});
+	return ret;
+}
+
+void Map::handle_cell_collision(automa::ServiceProvider& svc, arms::Projectile& proj) {
+	// walk the cells the projectile crossed since last tick so fast projectiles can't tunnel through thin walls
+	Tile* hit{};
+	auto first_contact{1.f};
+	get_layers().at(MIDDLEGROUND).grid.for_each_cell_along(proj.bounding_box, proj.physics.apparent_velocity(), [&hit, &first_contact, &proj](Tile& cell) {
+		if (!cell.is_collision_candidate() || !cell.is_collidable()) { return; }
+		auto contact = proj.bounding_box.sweep(proj.physics.apparent_velocity(), cell.bounding_box);
+		if (contact && (!hit || contact.value() < first_contact)) {
+			hit = &cell;
+			first_contact = contact.value();
 		}
+	});
+	if (!hit) { return; }
+	hit->collision_check = true;
+	if (!proj.stats.transcendent) {
+		if (!proj.destruction_initiated()) {
+			effects.push_back(entity::Effect(svc, proj.destruction_point + proj.physics.position, {}, proj.effect_type(), 2));
+			if (proj.direction.lr == dir::LR::neutral) { effects.back().rotate(); }
+		}
+		proj.destroy(false);
+	}
+	if (proj.stats.spring && hit->is_hookable()) {
+		if (proj.hook.grapple_flags.test(arms::GrappleState::probing)) {
+			proj.hook.spring.set_anchor(hit->middle_point());
+			proj.hook.grapple_triggers.set(arms::GrappleTriggers::found);
+		}
+		handle_grappling_hook(svc, proj);
 	}
-	return false;
 }
 
 void Map::handle_grappling_hook(automa::ServiceProvider& svc, arms::Projectile& proj) {
@@ -687,16 +689,45 @@ void Map::shake_camera() { flags.state.set(LevelState::camera_shake); }
 
 void Map::clear() {
 	dimensions = {};
+	collidable_indeces.clear();
+	active_projectiles.clear();
+	active_grenades.clear();
+	active_emitters.clear();
+	active_loot.clear();
+	effects.clear();
 	portals.clear();
+	inspectables.clear();
+	beds.clear();
+	animators.clear();
 	platforms.clear();
 	breakables.clear();
 	pushables.clear();
+	spawners.clear();
 	spikes.clear();
 	destroyers.clear();
 	switch_blocks.clear();
 	switch_buttons.clear();
 	chests.clear();
 	npcs.clear();
+	enemy_spawns.clear();
+	enemy_catalog.enemies.clear();
+	flags.state = {};
+}
+
+// rebuilds the room's entities from its already parsed data. layers, layer textures, the background and minimap bakes are kept,
+// which makes this the cheap way back into the room that is already loaded.
+void Map::restore(automa::ServiceProvider& svc) {
+	clear();
+	load(svc, room_id, true);
+	populate(svc);
+	if (auto const& music = svc.data.room_cache.get(room_id).data.placements.meta.music; !music.empty()) {
+		svc.music.load(music);
+		svc.music.play_looped(10);
+	}
+	player->map_reset();
+	transition.current_frame = 0;
+	transition.fade_out = false;
+	transition.fade_in = true;
 }
 
 std::vector<Layer>& Map::get_layers() { return m_services->data.get_layers(room_id); }
@@ -712,4 +743,10 @@ bool Map::nearby(shape::Shape& first, shape::Shape& second) const {
 	return abs(first.position.x + first.dimensions.x * 0.5f - second.position.x) < lookup::unit_size_f * collision_barrier && abs(first.position.y - second.position.y) < lookup::unit_size_f * collision_barrier;
 }
 
+int Map::get_drop_height(sf::Vector2<float> point) {
+	auto& grid = get_layers().at(MIDDLEGROUND).grid;
+	auto const index = grid.get_index(point);
+	return index ? grid.get_drop_height(*index) : 0;
+}
+
 } // namespace world
@@ -11,6 +11,8 @@
 #include "../graphics/Background.hpp"
 #include "../graphics/Transition.hpp"
 #include "Grid.hpp"
+#include "Broadphase.hpp"
+#include "Activation.hpp"
 #include "../utils/Random.hpp"
 #include "../utils/Shape.hpp"
 #include "../particle/Effect.hpp"
@@ -28,6 +30,7 @@
 #include "Destroyable.hpp"
 #include "../weapon/Grenade.hpp"
 #include "../utils/Stopwatch.hpp"
+#include "../graphics/DrawList.hpp"
 
 int const NUM_LAYERS{8};
 int const CHUNK_SIZE{16};
@@ -49,12 +52,6 @@ class InventoryWindow;
 
 namespace world {
 
-enum LAYER_ORDER {
-	BACKGROUND = 0,
-	MIDDLEGROUND = 4,
-	FOREGROUND = 7,
-};
-
 enum class LevelState { game_over, camera_shake, spawn_enemy };
 
 // a Layer is a grid with a render priority and a flag to determine if scene entities can collide with it.
@@ -89,17 +86,26 @@ class Map {
 	~Map() {}
 
 	// methods
+	// a soft load reads only the room's layout: no music, style or textures, and none of its residents (npcs, chests,
+	// animators, beds, inspectables, enemies, destroyers)
 	void load(automa::ServiceProvider& svc, int room_number, bool soft = false);
+	void restore(automa::ServiceProvider& svc);
 	void update(automa::ServiceProvider& svc, gui::Console& console, gui::InventoryWindow& inventory_window);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
-	void render_background(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
-	void render_console(automa::ServiceProvider& svc, gui::Console& console, sf::RenderWindow& win);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
+	void render_background(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
+	void render_console(automa::ServiceProvider& svc, gui::Console& console, flfx::DrawList& win);
 	void spawn_projectile_at(automa::ServiceProvider& svc, arms::Weapon& weapon, sf::Vector2<float> pos);
 	void spawn_enemy(int id, sf::Vector2<float> pos);
 	void manage_projectiles(automa::ServiceProvider& svc);
 	void generate_collidable_layer(bool live = false);
+	void update_broadphase();
+	void update_emitters(automa::ServiceProvider& svc);
+	static constexpr std::size_t parallel_particles{512}; // fewer particles than this integrate serially
+	void wake_bodies();
+	bool is_disturbed(shape::Collider const& body);
 	void generate_layer_textures(automa::ServiceProvider& svc);
 	bool check_cell_collision(shape::Collider collider);
+	void handle_cell_collision(automa::ServiceProvider& svc, arms::Projectile& proj);
 	void handle_grappling_hook(automa::ServiceProvider& svc, arms::Projectile& proj);
 	void shake_camera();
 	void clear();
@@ -107,6 +113,14 @@ class Map {
 	Vec get_spawn_position(int portal_source_map_id);
 
 	bool nearby(shape::Shape& first, shape::Shape& second) const;
+	int get_drop_height(sf::Vector2<float> point);
+
+	// visits only the collidable middleground cells under the region instead of walking collidable_indeces.
+	// runs of plain solid cells are visited as one merged block, so check is_merged() before assuming a 32x32 tile.
+	template <typename F>
+	void for_each_collidable_cell(shape::Shape const& region, F&& fn) {
+		get_layers().at(MIDDLEGROUND).grid.for_each_body_in(region, fn);
+	}
 	[[nodiscard]] auto off_the_bottom(sf::Vector2<float> point) const -> bool { return point.y > real_dimensions.y + abyss_distance; }
 	[[nodiscard]] auto camera_shake() const -> bool { return flags.state.test(LevelState::camera_shake); }
 
@@ -120,6 +134,10 @@ class Map {
 
 	dj::Json inspectable_data{};
 
+	Broadphase broadphase{}; // rebuilt by update_broadphase() whenever entity containers may have changed
+	Activation activation{}; // decides which chunks of the room are simulated this tick
+	uint32_t tile_revision{}; // last seen middleground revision, so sleeping bodies wake when tiles change
+
 	// entities
 	std::vector<arms::Projectile> active_projectiles{};
 	std::vector<arms::Grenade> active_grenades{};
@@ -158,7 +176,6 @@ class Map {
 	sf::Sprite layer_sprite{};
 	std::string_view style_label{};
 
-	int room_lookup{};
 	int style_id{};
 	int native_style_id{};
 	struct {
@@ -186,6 +203,8 @@ class Map {
 	util::Cooldown end_demo{500};
 
   private:
+	void populate(automa::ServiceProvider& svc);
+
 	int abyss_distance{400};
 	struct {
 		util::BitFlags<LevelState> state{};
@@ -72,17 +72,20 @@ void Platform::update(automa::ServiceProvider& svc, world::Map& map, player::Pla
 	//map changes
 
 	//platform changes
-	for (auto& breakable : map.breakables) { handle_collider_collision(breakable.get_hurtbox()); }
-	for (auto& pushable : map.pushables) {
+	map.broadphase.query_aabb(vicinity, world::Body::breakable, [this, &map](std::size_t index) { handle_collider_collision(map.breakables.at(index).get_hurtbox()); });
+	map.broadphase.query_aabb(vicinity, world::Body::pushable, [this, &map](std::size_t index) {
 		// platform should reverse direction upon hitting the sides or top of a pushable
+		auto& pushable = map.pushables.at(index);
 		if (!pushable.collider.jumpbox.overlaps(bounding_box)) { handle_collider_collision(pushable.get_hurtbox()); }
-	}
-	for (auto& block : map.switch_blocks) {
+	});
+	map.broadphase.query_aabb(vicinity, world::Body::switch_block, [this, &map](std::size_t index) {
+		auto& block = map.switch_blocks.at(index);
 		if (block.on()) { handle_collider_collision(block.get_hurtbox()); }
-	}
-	for (auto& platform : map.platforms) {
+	});
+	map.broadphase.query_aabb(vicinity, world::Body::platform, [this, &map](std::size_t index) {
+		auto& platform = map.platforms.at(index);
 		if (&platform != this && native_direction.lr != platform.native_direction.lr) { handle_collider_collision(platform.hurtbox); }
-	}
+	});
 	if (flags.state.test(PlatformState::moving)) {
 		if (native_direction.lr == dir::LR::left) {
 			if (Collider::flags.external_state.consume(shape::ExternalState::horiz_collider_collision) && !switch_up.running()) {
@@ -115,11 +118,12 @@ void Platform::update(automa::ServiceProvider& svc, world::Map& map, player::Pla
 			if (player.collider.jumpbox.overlaps(bounding_box) && !player.collider.perma_grounded() && flags.attributes.test(PlatformAttributes::sticky)) {
 				if (!(abs(physics.velocity.x) > skip_value || abs(physics.velocity.y) > skip_value)) { player.forced_momentum = physics.position - old_position; }
 			}
-			for (auto& pushable : map.pushables) {
+			map.broadphase.query_aabb(bounding_box, world::Body::pushable, [this, &map, skip_value, old_position](std::size_t index) {
+				auto& pushable = map.pushables.at(index);
 				if (pushable.collider.jumpbox.overlaps(bounding_box) && !pushable.collider.perma_grounded() && flags.attributes.test(PlatformAttributes::sticky)) {
 					if (!(abs(physics.velocity.x) > skip_value || abs(physics.velocity.y) > skip_value)) { pushable.forced_momentum = physics.position - old_position; }
 				}
-			}
+			});
 			break;
 		} else {
 			edge_start = edge_end;
@@ -150,6 +154,11 @@ void Platform::update(automa::ServiceProvider& svc, world::Map& map, player::Pla
 	if (path_position > 1.0f) { path_position = 0.0f; }
 	if (path_position < 0.0f) { path_position = 0.0f; }
 
+	// platforms follow their track instead of integrating, so they record where the tick began for rendering.
+	// the first placement and the jump back to the start of a track snap instead of sliding there.
+	physics.previous_position = old_position;
+	if (!counter.running() || abs(physics.velocity.x) > skip_value || abs(physics.velocity.y) > skip_value) { physics.previous_position = physics.position; }
+
 	sync_components();
 
 	if (old_position != physics.position) {
@@ -162,9 +171,9 @@ void Platform::update(automa::ServiceProvider& svc, world::Map& map, player::Pla
 	animation.update();
 }
 
-void Platform::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Platform::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	track_shape.setPosition(-cam.x, -cam.y);
-	sprite.setPosition(physics.position - cam);
+	sprite.setPosition(get_interpolated_position(svc.ticker.get_alpha()) - cam);
 	auto u = state * 96;
 	auto v = animation.get_frame() * 224;
 	auto lookup = sf::Vector2<int>{u, v} + offset;
@@ -18,7 +18,7 @@ Pushable::Pushable(automa::ServiceProvider& svc, sf::Vector2<float> position, in
 	mass = static_cast<float>(size);
 	collider.sync_components();
 	auto snap = collider.snap_to_grid(static_cast<float>(size));
-	collider.physics.position = snap;
+	collider.set_position(snap);
 	start_box = collider.bounding_box;
 	sprite.setTexture(svc.assets.t_pushables);
 	sf::IntRect lookup = size == 1 ? sf::IntRect{{style * 2 * svc.constants.i_cell_size, 0}, svc.constants.i_cell_vec} : sf::IntRect{{style * 2 * svc.constants.i_cell_size, svc.constants.i_cell_size}, 2 * svc.constants.i_cell_vec};
@@ -28,7 +28,7 @@ Pushable::Pushable(automa::ServiceProvider& svc, sf::Vector2<float> position, in
 void Pushable::update(automa::ServiceProvider& svc, Map& map, player::Player& player) {
 	energy = std::clamp(energy - dampen, 0.f, std::numeric_limits<float>::max());
 	if (energy < 0.2f) { energy = 0.f; }
-	if (svc.ticker.every_x_ticks(20)) { random_offset = svc.random.random_vector_float(-energy, energy); }
+	if (svc.ticker.every_x_ticks(20)) { random_offset = svc.random.vfx.random_vector_float(-energy, energy); }
 	weakened.update();
 	if (weakened.is_complete()) { hit_count.start(); }
 	player.on_crush(map);
@@ -38,9 +38,10 @@ void Pushable::update(automa::ServiceProvider& svc, Map& map, player::Player& pl
 	if (hit_count.get_count() > 3 || map.off_the_bottom(collider.physics.position)) {
 		bool can_respawn = true;
 		if (player.collider.bounding_box.overlaps(start_box)) { can_respawn = false; }
-		for (auto& p : map.pushables) {
+		map.broadphase.query_aabb(start_box, Body::pushable, [this, &map, &can_respawn](std::size_t index) {
+			auto& p = map.pushables.at(index);
 			if (p.get_bounding_box().overlaps(start_box) && &p != this) { can_respawn = false; }
-		}
+		});
 		if (can_respawn) {
 			reset(svc, map);
 			svc.soundboard.flags.world.set(audio::World::small_crash);
@@ -48,6 +49,12 @@ void Pushable::update(automa::ServiceProvider& svc, Map& map, player::Player& pl
 		hit_count.start();
 	}
 
+	// resting blocks skip their simulation until something could move them
+	if (collider.asleep()) {
+		if (!map.is_disturbed(collider) && collider.physics.acceleration == sf::Vector2<float>{} && forced_momentum == sf::Vector2<float>{}) { return; }
+		collider.wake();
+	}
+
 	//player pushes block
 	if (player.collider.wallslider.overlaps(collider.bounding_box) && player.pushing()) {
 		if (player.controller.moving_left() && player.collider.physics.position.x > collider.physics.position.x) { collider.physics.acceleration.x = -speed / mass; }
@@ -82,26 +89,30 @@ void Pushable::update(automa::ServiceProvider& svc, Map& map, player::Player& pl
 	if (collider.has_left_wallslide_collision() || collider.has_right_wallslide_collision() || collider.flags.external_state.test(shape::ExternalState::vert_world_collision) || collider.world_grounded()) { forced_momentum = {}; }
 	collider.update(svc);
 	collider.detect_map_collision(map);
-	for (auto& other : map.pushables) {
-		if (&other == this) { continue; }
+	map.broadphase.query_aabb(collider.vicinity, Body::pushable, [this, &map](std::size_t index) {
+		auto& other = map.pushables.at(index);
+		if (&other == this) { return; }
 		if (other.collider.wallslider.overlaps(collider.bounding_box)) {
 			if (collider.pushes(other.collider)) { other.collider.physics.velocity.x = collider.physics.velocity.x * 2.f; }
 		}
 		collider.handle_collider_collision(other.collider.bounding_box);
-	}
-	for (auto& spike : map.spikes) { collider.handle_collider_collision(spike.get_bounding_box()); }
-	for (auto& breakable : map.breakables) { collider.handle_collider_collision(breakable.get_bounding_box()); }
-	for (auto& block : map.switch_blocks) {
+	});
+	map.broadphase.query_aabb(collider.vicinity, Body::spike, [this, &map](std::size_t index) { collider.handle_collider_collision(map.spikes.at(index).get_bounding_box()); });
+	map.broadphase.query_aabb(collider.vicinity, Body::breakable, [this, &map](std::size_t index) { collider.handle_collider_collision(map.breakables.at(index).get_bounding_box()); });
+	map.broadphase.query_aabb(collider.vicinity, Body::switch_block, [this, &map](std::size_t index) {
+		auto& block = map.switch_blocks.at(index);
 		if (block.on()) { collider.handle_collider_collision(block.get_bounding_box()); }
-	}
+	});
 	// pushable should only be moved by a platform if it's on top of one
-	for (auto& platform : map.platforms) {
+	map.broadphase.query_aabb(collider.jumpbox, Body::platform, [this, &map](std::size_t index) {
+		auto& platform = map.platforms.at(index);
 		if (platform.bounding_box.overlaps(collider.jumpbox)) { collider.handle_collider_collision(platform.bounding_box); }
-	}
+	});
 	if (collider.flags.state.test(shape::State::just_landed)) {
 		map.effects.push_back(entity::Effect(svc, {collider.physics.position.x + 32.f * (size / 2.f), collider.physics.position.y + (size - 1) * 32.f}, {}, 0, 10));
 		svc.soundboard.flags.world.set(audio::World::thud);
 	}
+	collider.settle();
 	collider.reset();
 	collider.reset_ground_flags();
 	collider.physics.acceleration = {};
@@ -109,11 +120,12 @@ void Pushable::update(automa::ServiceProvider& svc, Map& map, player::Player& pl
 
 void Pushable::handle_collision(shape::Collider& other) const { other.handle_collider_collision(collider.bounding_box); }
 
-void Pushable::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Pushable::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
+	auto const position = collider.get_interpolated_position(svc.ticker.get_alpha());
 	snap = collider.snap_to_grid(1, 4.f, 2.f);
-	if (abs(random_offset.x) > 0.f || abs(random_offset.y) > 0.f) { snap = collider.physics.position; } // don't snap if shaking
-	if (abs(collider.physics.velocity.x) > 0.5f) { snap.x = collider.physics.position.x; } // don't snap if moving
-	if (abs(collider.physics.velocity.y) > 0.5f) { snap.y = collider.physics.position.y; }
+	if (abs(random_offset.x) > 0.f || abs(random_offset.y) > 0.f) { snap = position; } // don't snap if shaking
+	if (abs(collider.physics.velocity.x) > 0.5f) { snap.x = position.x; } // don't snap if moving
+	if (abs(collider.physics.velocity.y) > 0.5f) { snap.y = position.y; }
 	sprite.setPosition(snap - cam + random_offset - sprite_offset);
 	if (svc.greyblock_mode()) {
 		collider.render(win, cam);
@@ -146,7 +158,8 @@ void Pushable::reset(automa::ServiceProvider& svc, world::Map& map) {
 	auto index = size == 1 ? 0 : 1;
 	auto offset = size == 1 ? sf::Vector2<float>{} : sf::Vector2<float>{5.f, 5.f};
 	map.effects.push_back(entity::Effect(svc, collider.physics.position + offset, {}, 0, index));
-	collider.physics.position = start_position;
+	collider.set_position(start_position);
+	collider.wake();
 	map.effects.push_back(entity::Effect(svc, collider.physics.position + offset, {}, 0, index));
 }
 
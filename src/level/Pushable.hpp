@@ -7,6 +7,7 @@
 #include "../utils/Cooldown.hpp"
 #include "../utils/Counter.hpp"
 #include "../entities/animation/Animation.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -30,7 +31,7 @@ class Pushable {
 	Pushable(automa::ServiceProvider& svc, sf::Vector2<float> position, int style = 0, int size = 1);
 	void update(automa::ServiceProvider& svc, Map& map, player::Player& player);
 	void handle_collision(shape::Collider& other) const;
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void on_hit(automa::ServiceProvider& svc, world::Map& map, arms::Projectile& proj);
 	void reset(automa::ServiceProvider& svc, world::Map& map);
 	shape::Shape& get_bounding_box() { return collider.bounding_box; }
@@ -28,6 +28,7 @@ class Spawner {
 	Spawner(automa::ServiceProvider& svc, sf::Vector2<float> position, int enemy_id = 0);
 	void update(automa::ServiceProvider& svc, Map& map);
 	void set_id(int id) { enemy_id = id; }
+	[[nodiscard]] auto get_position() const -> sf::Vector2<float> { return position; }
 
   private:
 	sf::Vector2<float> position{};
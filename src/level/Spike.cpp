@@ -28,7 +28,7 @@ void Spike::handle_collision(shape::Collider& other) const {
 	other.handle_collider_collision(collider.bounding_box);
 }
 
-void Spike::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Spike::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (svc.greyblock_mode()) { collider.render(win, cam); }
 }
 
@@ -6,6 +6,7 @@
 #include "../utils/Collider.hpp"
 #include "../utils/Counter.hpp"
 #include "../entities/animation/Animation.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -28,7 +29,7 @@ class Spike {
 	Spike(automa::ServiceProvider& svc, sf::Vector2<float> position, int lookup);
 	void update(automa::ServiceProvider& svc, world::Map& map);
 	void handle_collision(shape::Collider& other) const;
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	shape::Shape& get_bounding_box() { return collider.bounding_box; }
 	shape::Shape& get_hurtbox() { return collider.hurtbox; }
 
@@ -29,7 +29,7 @@ void SwitchBlock::update(automa::ServiceProvider& svc, Map& map, player::Player&
 
 void SwitchBlock::handle_collision(shape::Collider& other) const { other.handle_collider_collision(collider.bounding_box); }
 
-void SwitchBlock::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam, bool background) {
+void SwitchBlock::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam, bool background) {
 	if (state == SwitchBlockState::empty && !background) { return; }
 	sprite.setPosition(collider.physics.position - cam);
 	sprite.setTextureRect(sf::IntRect{{static_cast<int>(type) * 32, static_cast<int>(state) * 32}, {32, 32}});
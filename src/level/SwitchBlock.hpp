@@ -7,6 +7,7 @@
 #include "../utils/Counter.hpp"
 #include "../entities/animation/Animation.hpp"
 #include "SwitchButton.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -31,7 +32,7 @@ class SwitchBlock {
 	SwitchBlock(automa::ServiceProvider& svc, sf::Vector2<float> position, int button_id, int type);
 	void update(automa::ServiceProvider& svc, Map& map, player::Player& player);
 	void handle_collision(shape::Collider& other) const;
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam, bool background = false);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam, bool background = false);
 	void on_hit(automa::ServiceProvider& svc, world::Map& map, arms::Projectile& proj, int power = 1);
 	void turn_off() { state = SwitchBlockState::empty; }
 	void turn_on() { state = SwitchBlockState::full; }
@@ -59,20 +59,16 @@ void SwitchButton::update(automa::ServiceProvider& svc, Map& map, player::Player
 
 	//assume unpressed, then check everything for a press
 	if (type != SwitchType::permanent) { state = SwitchButtonState::unpressed; }
-	for (auto& breakable : map.breakables) { collider.handle_collider_collision(breakable.get_bounding_box()); }
-	for (auto& platform : map.platforms) {
-		if (platform.bounding_box.overlaps(sensor)) {
-			state = SwitchButtonState::pressed;
-		}
-	}
-	for (auto& chest : map.chests) {
-		if (chest.get_jumpbox().overlaps(sensor)) {
-			state = SwitchButtonState::pressed;
-		}
-	}
-	for (auto& pushable : map.pushables) {
-		if (pushable.collider.jumpbox.overlaps(sensor)) { state = SwitchButtonState::pressed; }
-	}
+	map.broadphase.query_aabb(collider.vicinity, Body::breakable, [this, &map](std::size_t index) { collider.handle_collider_collision(map.breakables.at(index).get_bounding_box()); });
+	map.broadphase.query_aabb(sensor, Body::platform, [this, &map](std::size_t index) {
+		if (map.platforms.at(index).bounding_box.overlaps(sensor)) { state = SwitchButtonState::pressed; }
+	});
+	map.broadphase.query_aabb(sensor, Body::chest, [this, &map](std::size_t index) {
+		if (map.chests.at(index).get_jumpbox().overlaps(sensor)) { state = SwitchButtonState::pressed; }
+	});
+	map.broadphase.query_aabb(sensor, Body::pushable, [this, &map](std::size_t index) {
+		if (map.pushables.at(index).collider.jumpbox.overlaps(sensor)) { state = SwitchButtonState::pressed; }
+	});
 	if (player.collider.jumpbox.overlaps(sensor)) {
 		state = SwitchButtonState::pressed;
 	}
@@ -94,7 +90,7 @@ void SwitchButton::update(automa::ServiceProvider& svc, Map& map, player::Player
 
 void SwitchButton::handle_collision(shape::Collider& other) const { other.handle_collider_collision(collider.bounding_box); }
 
-void SwitchButton::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void SwitchButton::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (svc.greyblock_mode()) {
 		collider.render(win, cam);
 		sensorbox.setPosition(sensor.position - cam);
@@ -8,6 +8,7 @@
 #include "../entities/animation/Animation.hpp"
 #include "../entities/animation/AnimatedSprite.hpp"
 #include "../utils/StateFunction.hpp"
+#include "../graphics/DrawList.hpp"
 #define SWITCH_BIND(f) std::bind(&SwitchButton::f, this)
 
 namespace automa {
@@ -32,7 +33,7 @@ class SwitchButton {
 	SwitchButton(automa::ServiceProvider& svc, sf::Vector2<float> position, int id, int type, Map& map);
 	void update(automa::ServiceProvider& svc, Map& map, player::Player& player);
 	void handle_collision(shape::Collider& other) const;
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void on_hit(automa::ServiceProvider& svc, world::Map& map, arms::Projectile& proj);
 	shape::Shape& get_bounding_box() { return collider.bounding_box; }
 	shape::Shape& get_hurtbox() { return collider.hurtbox; }
@@ -21,7 +21,7 @@ void Tile::update_polygon(sf::Vector2<float> cam) {
 	polygon.setOutlineThickness(0);
 }
 
-void Tile::render(sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Tile::render(flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (collision_check) {
 		update_polygon(cam);
 		if (!surrounded) {
@@ -35,8 +35,10 @@ void Tile::render(sf::RenderWindow& win, sf::Vector2<float> cam) {
 	}
 }
 
-void Tile::set_type() {
-	type = TileType::empty;
+void Tile::set_type() { type = get_type(value); }
+
+auto Tile::get_type(uint8_t value) -> TileType {
+	auto type = TileType::empty;
 	if (value < 192 && value > 0) { type = TileType::solid; }
 	if (value < 208 && value >= 192) { type = TileType::ceiling_ramp; }
 	if (value < 224 && value >= 208) { type = TileType::ground_ramp; }
@@ -46,6 +48,20 @@ void Tile::set_type() {
 	if (value == 231) { type = TileType::spawner; }
 	if (value < 248 && value >= 244) { type = TileType::breakable; }
 	if (value >= 248) { type = TileType::spike; }
+	return type;
+}
+
+namespace {
+// what an sfml shape keeps on the heap once updated: a fill fan of count + 2 vertices and an outline strip of (count + 1) * 2
+auto vertex_memory(sf::Shape const& shape) -> std::size_t {
+	auto const count = shape.getPointCount();
+	return count < 3 ? 0 : (count + 2 + (count + 1) * 2) * sizeof(sf::Vertex);
+}
+} // namespace
+
+auto Tile::memory() const -> std::size_t {
+	// the bounding box's polygons are inline, so sizeof covers them. only the drawables allocate.
+	return sizeof(Tile) + polygon.getPointCount() * sizeof(sf::Vector2<float>) + vertex_memory(polygon) + vertex_memory(drawbox);
 }
 
 sf::Vector2<float> Tile::middle_point() { return {position.x + bounding_box.dimensions.x / 2, position.y + bounding_box.dimensions.y / 2}; }
@@ -3,11 +3,12 @@
 #include "../setup/EnumLookups.hpp"
 #include "../utils/Shape.hpp"
 #include "../utils/BitFlags.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace world {
 
 enum class TileType { empty, solid, platform, ceiling_ramp, ground_ramp, spike, death_spike, breakable, pushable, spawner };
-enum class TileState { ramp_adjacent, big_ramp };
+enum class TileState { ramp_adjacent, big_ramp, merged };
 
 struct Tile {
 
@@ -15,8 +16,11 @@ struct Tile {
 	Tile(sf::Vector2<uint32_t> i, sf::Vector2<float> p, uint32_t val);
 
 	void update_polygon(sf::Vector2<float> cam); // for greyblock mode
-	void render(sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(flfx::DrawList& win, sf::Vector2<float> cam);
 	void set_type();
+	[[nodiscard]] static auto get_type(uint8_t value) -> TileType;
+	// bytes this tile holds, counting what its drawables allocate
+	[[nodiscard]] auto memory() const -> std::size_t;
 	[[nodiscard]] auto is_occupied() const -> bool { return value > 0; }
 	[[nodiscard]] auto is_collidable() const -> bool { return type == TileType::solid || is_ramp() || is_spawner(); }
 	[[nodiscard]] auto is_solid() const -> bool { return type == TileType::solid; }
@@ -33,6 +37,8 @@ struct Tile {
 	[[nodiscard]] auto is_spawner() const -> bool { return type == TileType::spawner; }
 	[[nodiscard]] auto is_special() const -> bool { return is_pushable() || is_breakable(); }
 	[[nodiscard]] auto ramp_adjacent() const -> bool { return flags.test(TileState::ramp_adjacent); }
+	[[nodiscard]] auto is_merged() const -> bool { return flags.test(TileState::merged); }
+	[[nodiscard]] auto is_collision_candidate() const -> bool { return !surrounded && is_occupied() && !is_special(); }
 
 	sf::Vector2<float> middle_point();
 
@@ -0,0 +1,21 @@
+#include "TilePlane.hpp"
+
+namespace world {
+
+TilePlane::TilePlane(sf::Vector2<uint32_t> dimensions) : dimensions(dimensions) {
+	chunks_per_row = (dimensions.x + chunk_size - 1) / chunk_size;
+	auto const rows = (dimensions.y + chunk_size - 1) / chunk_size;
+	chunks.assign(std::size_t{chunks_per_row} * rows, empty_chunk);
+}
+
+void TilePlane::set(uint32_t index, uint8_t value) {
+	auto& slot = chunks[get_chunk(index)];
+	if (slot == empty_chunk) {
+		if (value == 0) { return; }
+		slot = static_cast<uint32_t>(storage.size() / chunk_area);
+		storage.resize(storage.size() + chunk_area);
+	}
+	storage[slot * chunk_area + get_offset(index)] = value;
+}
+
+} // namespace world
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace world {
+
+// one byte per cell, stored in 16x16 chunks. chunks that hold nothing but empty cells are never allocated,
+// so the mostly empty decorative layers cost a few bytes per chunk instead of one per cell.
+class TilePlane {
+  public:
+	static constexpr uint32_t chunk_size{16};
+
+	TilePlane() = default;
+	explicit TilePlane(sf::Vector2<uint32_t> dimensions);
+
+	[[nodiscard]] auto get(uint32_t index) const -> uint8_t {
+		auto const slot = chunks[get_chunk(index)];
+		return slot == empty_chunk ? uint8_t{} : storage[slot * chunk_area + get_offset(index)];
+	}
+	// writing zero never allocates, so loading a plane only pays for the chunks that hold tiles
+	void set(uint32_t index, uint8_t value);
+
+	// calls fn(index, value) for every occupied cell, chunk by chunk
+	template <typename F>
+	void for_each_occupied(F&& fn) const {
+		for (uint32_t chunk{0}; chunk < chunks.size(); ++chunk) {
+			auto const slot = chunks[chunk];
+			if (slot == empty_chunk) { continue; }
+			auto const origin = sf::Vector2<uint32_t>{(chunk % chunks_per_row) * chunk_size, (chunk / chunks_per_row) * chunk_size};
+			for (uint32_t offset{0}; offset < chunk_area; ++offset) {
+				auto const value = storage[slot * chunk_area + offset];
+				if (value == 0) { continue; }
+				auto const x = origin.x + offset % chunk_size;
+				auto const y = origin.y + offset / chunk_size;
+				fn(y * dimensions.x + x, value);
+			}
+		}
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t { return std::size_t{dimensions.x} * dimensions.y; }
+	[[nodiscard]] auto allocated_chunks() const -> std::size_t { return storage.size() / chunk_area; }
+	[[nodiscard]] auto memory() const -> std::size_t { return sizeof(TilePlane) + chunks.capacity() * sizeof(uint32_t) + storage.capacity(); }
+
+  private:
+	static constexpr uint32_t chunk_area{chunk_size * chunk_size};
+	static constexpr uint32_t empty_chunk{std::numeric_limits<uint32_t>::max()};
+
+	[[nodiscard]] auto get_chunk(uint32_t index) const -> uint32_t { return (index / dimensions.x / chunk_size) * chunks_per_row + (index % dimensions.x) / chunk_size; }
+	[[nodiscard]] auto get_offset(uint32_t index) const -> uint32_t { return ((index / dimensions.x) % chunk_size) * chunk_size + (index % dimensions.x) % chunk_size; }
+
+	sf::Vector2<uint32_t> dimensions{};
+	uint32_t chunks_per_row{};
+	std::vector<uint32_t> chunks{};	  // slot in storage for each chunk, or empty_chunk
+	std::vector<uint8_t> storage{}; // allocated chunks, chunk_area bytes each
+};
+
+} // namespace world
@@ -81,7 +81,7 @@ void Effect::update(automa::ServiceProvider& svc, world::Map& map) {
 	animation.update();
 }
 
-void Effect::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Effect::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	int u = type * sprite_dimensions.x;
 	int v = animation.get_frame() * sprite_dimensions.y;
 	sprite.setTextureRect({{u, v}, sprite_dimensions});
@@ -7,6 +7,7 @@
 #include "../entities/Entity.hpp"
 #include "../entities/animation/Animation.hpp"
 #include "../components/PhysicsComponent.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -18,7 +19,7 @@ class Effect : public Entity {
 	public:
 	Effect(automa::ServiceProvider& svc, sf::Vector2<float> pos, sf::Vector2<float> vel, int type = 0, int index = 0);
 	void update(automa::ServiceProvider& svc, world::Map& map);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void rotate();
 	[[nodiscard]] auto done() -> bool { return animation.complete(); }
 
@@ -19,20 +19,29 @@ Emitter::Emitter(automa::ServiceProvider& svc, sf::Vector2<float> position, sf::
 }
 
 void Emitter::update(automa::ServiceProvider& svc, world::Map& map) {
+	emit(svc);
+	integrate(svc, map);
+}
+
+// draws from the vfx stream, which is not thread safe, so it has to run serially
+void Emitter::emit(automa::ServiceProvider& svc) {
 	cooldown.update();
 	if (cooldown.is_complete()) { deactivate(); }
-	if (active && (svc.random.percent_chance(variables.rate) || particles.empty())) {
-		auto x = svc.random.random_range_float(0.f, dimensions.x);
-		auto y = svc.random.random_range_float(0.f, dimensions.y);
+	if (active && (svc.random.vfx.percent_chance(variables.rate) || particles.empty())) {
+		auto x = svc.random.vfx.random_range_float(0.f, dimensions.x);
+		auto y = svc.random.vfx.random_range_float(0.f, dimensions.y);
 		sf::Vector2<float> point{position.x + x, position.y + y};
 		particles.push_back(Particle(svc, point, particle_dimensions, type, color, direction));
-	
 	}
+}
+
+// only touches this emitter's particles, so emitters can integrate in parallel
+void Emitter::integrate(automa::ServiceProvider& svc, world::Map& map) {
 	for (auto& particle : particles) { particle.update(svc, map); }
 	std::erase_if(particles, [](auto const& p) { return p.done(); });
 }
 
-void Emitter::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Emitter::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (svc.greyblock_mode()) {
 		drawbox.setPosition(position - cam);
 		win.draw(drawbox);
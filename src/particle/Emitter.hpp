@@ -3,6 +3,7 @@
 
 #include <vector>
 #include "Particle.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace vfx {
 
@@ -11,11 +12,14 @@ class Emitter {
 	Emitter() = default;
 	Emitter(automa::ServiceProvider& svc, sf::Vector2<float> position, sf::Vector2<float> dimensions, std::string_view type, sf::Color color, dir::Direction direction);
 	void update(automa::ServiceProvider& svc, world::Map& map);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void emit(automa::ServiceProvider& svc);
+	void integrate(automa::ServiceProvider& svc, world::Map& map);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void set_position(sf::Vector2<float> pos);
 	void set_dimensions(sf::Vector2<float> dim);
 	void deactivate();
 	[[nodiscard]] auto done() const -> bool { return particles.empty(); }
+	[[nodiscard]] auto size() const -> std::size_t { return particles.size(); }
 
   private:
 	std::vector<Particle> particles{};
@@ -24,10 +24,7 @@ void Gravitator::update(automa::ServiceProvider& svc) {
 
 void Gravitator::add_force(sf::Vector2<float> force) { collider.physics.apply_force(force); }
 
-void Gravitator::set_position(Vec new_position) {
-	collider.physics.position = new_position;
-	collider.sync_components();
-}
+void Gravitator::set_position(Vec new_position) { collider.set_position(new_position); }
 
 void Gravitator::set_target_position(Vec new_position) {
 
@@ -55,7 +52,7 @@ void Gravitator::set_target_position(Vec new_position) {
 	collider.physics.apply_force({force_x, force_y});
 }
 
-void Gravitator::render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos, int history) {
+void Gravitator::render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos, int history) {
 
 	//just for antennae, can be improved a lot
 	auto prev_color = box.getFillColor();
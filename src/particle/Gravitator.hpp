@@ -3,6 +3,7 @@
 
 #include <string>
 #include "../utils/Collider.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -22,7 +23,7 @@ class Gravitator {
 	void add_force(sf::Vector2<float> force);
 	void set_position(Vec new_position);
 	void set_target_position(Vec new_position);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, Vec campos, int history = 0);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, Vec campos, int history = 0);
 
 	shape::Collider collider{};
 	Vecu16 scaled_position{};
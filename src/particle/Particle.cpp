@@ -1,12 +1,14 @@
 
 #include "Particle.hpp"
 #include "../service/ServiceProvider.hpp"
+#include <array>
 #include <numbers>
 
 namespace vfx {
 
 Particle::Particle(automa::ServiceProvider& svc, sf::Vector2<float> pos, sf::Vector2<float> dim, std::string_view type, sf::Color color, dir::Direction direction) : position(pos), dimensions(dim), sprite_dimensions(dim) {
 	collider = shape::Collider(dimensions);
+	collider.flags.general.set(shape::General::unmarked); // particles integrate on worker threads, so they leave the tiles' debug marks alone
 	collider.sync_components();
 	box.setFillColor(color);
 	box.setSize(dimensions);
@@ -22,20 +24,23 @@ Particle::Particle(automa::ServiceProvider& svc, sf::Vector2<float> pos, sf::Vec
 	if ((dj::Boolean)in_data["animated"].as_bool()) { flags.set(ParticleType::animated); }
 	if ((dj::Boolean)in_data["colliding"].as_bool()) { flags.set(ParticleType::colliding); }
 
-	auto angle = svc.random.random_range_float(-angle_range, angle_range);
+	// one batch for both spreads; particles come in bursts, so this is the hot path for the vfx stream
+	std::array<float, 2> spread{};
+	svc.random.vfx.fill(spread, -1.f, 1.f);
+	auto angle = spread[0] * angle_range;
 	auto f_pi = static_cast<float>(std::numbers::pi);
 	if (direction.lr == dir::LR::left) { angle += f_pi; }
 	if (direction.und == dir::UND::up) { angle += f_pi * 1.5f; }
 	if (direction.und == dir::UND::down) { angle += f_pi * 0.5f; }
 
-	expulsion += svc.random.random_range_float(-expulsion_variance, expulsion_variance);
+	expulsion += spread[1] * expulsion_variance;
 
 	collider.physics.apply_force_at_angle(expulsion, angle);
-	collider.physics.position = position;
+	collider.set_position(position);
 
 	auto lifespan_time = in_data["lifespan"].as<int>();
 	auto lifespan_variance = in_data["lifespan_variance"].as<int>();
-	int rand_diff = svc.random.random_range(-lifespan_variance, lifespan_variance);
+	int rand_diff = svc.random.vfx.random_range(-lifespan_variance, lifespan_variance);
 	lifespan.start(lifespan_time + rand_diff);
 
 	// for animated particles
@@ -64,19 +69,20 @@ void Particle::update(automa::ServiceProvider& svc, world::Map& map) {
 	if (fader) { fader.value().update(); }
 }
 
-void Particle::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) { 
+void Particle::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) { 
 	if (svc.greyblock_mode()) {
 		collider.render(win, cam);
 	} else {
+		auto const position = collider.get_interpolated_position(svc.ticker.get_alpha());
 		if (flags.test(ParticleType::animated)) {
 			sprite.setTextureRect(sf::IntRect{{0, animation.get_frame() * sprite_dimensions.y}, sprite_dimensions});
-			sprite.setPosition(collider.physics.position - cam);
+			sprite.setPosition(position - cam);
 			win.draw(sprite);
 		} else if (fader) {
-			fader.value().get_sprite().setPosition(collider.physics.position - cam);
+			fader.value().get_sprite().setPosition(position - cam);
 			win.draw(fader.value().get_sprite());
 		} else {
-			box.setPosition(collider.physics.position - cam);
+			box.setPosition(position - cam);
 			win.draw(box);
 		}
 	}
@@ -8,6 +8,7 @@
 #include "../utils/Cooldown.hpp"
 #include "../utils/Fader.hpp"
 #include "../entities/animation/Animation.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -23,7 +24,7 @@ class Particle {
   public:
 	Particle(automa::ServiceProvider& svc, sf::Vector2<float> pos, sf::Vector2<float> dim, std::string_view type, sf::Color color, dir::Direction direction);
 	void update(automa::ServiceProvider& svc, world::Map& map);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	[[nodiscard]] auto done() const -> bool { return lifespan.is_complete(); }
 
   private:
@@ -14,13 +14,13 @@ Spark::Spark(automa::ServiceProvider& svc, sf::Vector2<float> pos, sf::Color col
 	box.setFillColor(color);
 	box.setSize({3.f, 3.f});
 	auto variance = in_data["lifespan_variance"].as<int>();
-	auto rand_diff = svc.random.random_range(-variance, variance);
+	auto rand_diff = svc.random.vfx.random_range(-variance, variance);
 	lifespan.start(in_data["lifespan"].as<int>() + rand_diff);
 	parameters.volatility = in_data["volatility"].as<float>();
 
 	//seed variables
-	variables.energy = svc.random.random_range_float(1.0f - parameters.volatility, 1.0f + parameters.volatility);
-	variables.offset = svc.random.random_range_float(0.f, static_cast<float>(std::numbers::pi) * 2.f);
+	variables.energy = svc.random.vfx.random_range_float(1.0f - parameters.volatility, 1.0f + parameters.volatility);
+	variables.offset = svc.random.vfx.random_range_float(0.f, static_cast<float>(std::numbers::pi) * 2.f);
 
 	if (in_data["fader"].as_bool()) { fader = util::Fader(svc, lifespan.get_cooldown(), in_data["color"].as_string()); }
 	if (fader) { fader.value().get_sprite().setScale({3.f, 3.f}); }
@@ -35,7 +35,7 @@ void Spark::update(automa::ServiceProvider& svc) {
 	if (fader) { fader.value().update(); }
 }
 
-void Spark::render(sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Spark::render(flfx::DrawList& win, sf::Vector2<float> cam) {
 	box.setPosition(position - cam);
 	if (fader) {
 		fader.value().get_sprite().setPosition(position - cam);
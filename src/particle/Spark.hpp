@@ -6,6 +6,7 @@
 #include <SFML/Graphics.hpp>
 #include "../utils/Cooldown.hpp"
 #include "../utils/Fader.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -17,7 +18,7 @@ class Spark {
   public:
 	Spark(automa::ServiceProvider& svc, sf::Vector2<float> pos, sf::Color color, std::string_view type);
 	void update(automa::ServiceProvider& svc);
-	void render(sf::RenderWindow& win,sf::Vector2<float> cam);
+	void render(flfx::DrawList& win,sf::Vector2<float> cam);
 	[[nodiscard]] auto done() const -> bool { return lifespan.is_complete(); }
 
   private:
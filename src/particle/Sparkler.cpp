@@ -13,9 +13,9 @@ Sparkler::Sparkler(automa::ServiceProvider& svc, sf::Vector2<float> dimensions,
 }
 
 void Sparkler::update(automa::ServiceProvider& svc) {
-	if (svc.random.percent_chance(behavior.rate)) {
-		auto x = svc.random.random_range_float(0.f, dimensions.x);
-		auto y = svc.random.random_range_float(0.f, dimensions.y);
+	if (svc.random.vfx.percent_chance(behavior.rate)) {
+		auto x = svc.random.vfx.random_range_float(0.f, dimensions.x);
+		auto y = svc.random.vfx.random_range_float(0.f, dimensions.y);
 		sf::Vector2<float> point{position.x + x, position.y + y};
 		if (active) { sparkles.push_back(Spark(svc, point, color, type)); }
 	}
@@ -23,7 +23,7 @@ void Sparkler::update(automa::ServiceProvider& svc) {
 	std::erase_if(sparkles, [](auto const& s) { return s.done(); });
 }
 
-void Sparkler::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Sparkler::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	if (svc.greyblock_mode()) {
 		drawbox.setPosition(position - cam);
 		drawbox.setSize(dimensions);
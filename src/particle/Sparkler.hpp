@@ -3,6 +3,7 @@
 
 #include <vector>
 #include "Spark.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace vfx {
 
@@ -11,7 +12,7 @@ class Sparkler {
 	Sparkler() = default;
 	Sparkler(automa::ServiceProvider& svc, sf::Vector2<float> dimensions = {2.f, 2.f}, sf::Color color = sf::Color::White, std::string_view type = "");
 	void update(automa::ServiceProvider& svc);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	void set_position(sf::Vector2<float> pos);
 	void set_dimensions(sf::Vector2<float> dim);
 	void activate();
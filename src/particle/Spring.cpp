@@ -18,7 +18,7 @@ void Spring::update(automa::ServiceProvider& svc) {
 	bob = variables.physics.position;
 }
 
-void Spring::render(sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Spring::render(flfx::DrawList& win, sf::Vector2<float> cam) {
 	bob_shape.setRadius(8.f);
 	anchor_shape.setRadius(6.f);
 	bob_shape.setOrigin({bob_shape.getRadius(), bob_shape.getRadius()});
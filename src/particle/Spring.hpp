@@ -4,6 +4,7 @@
 #include <string>
 #include "../utils/Shape.hpp"
 #include "../components/PhysicsComponent.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace vfx {
 struct Parameters {
@@ -17,7 +18,7 @@ class Spring {
 	Spring(Parameters params);
 	void calculate();
 	void update(automa::ServiceProvider& svc);
-	void render(sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(flfx::DrawList& win, sf::Vector2<float> cam);
 	void calculate_force();
 	void reverse_anchor_and_bob();
 	void set_anchor(sf::Vector2<float> point);
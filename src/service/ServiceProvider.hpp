@@ -3,6 +3,7 @@
 #include "../setup/AssetManager.hpp"
 #include "../setup/DataManager.hpp"
 #include "../setup/TextManager.hpp"
+#include "../setup/WorldSnapshot.hpp"
 #include "../setup/Tables.hpp"
 #include "../automa/StateController.hpp"
 #include "../graphics/Style.hpp"
@@ -13,11 +14,12 @@
 #include "../audio/MusicPlayer.hpp"
 #include "../setup/ControllerMap.hpp"
 #include "../utils/Stopwatch.hpp"
+#include "../utils/JobSystem.hpp"
 #include "../story/QuestTracker.hpp"
 #include "../story/StatTracker.hpp"
 
 namespace automa {
-enum class DebugFlags { imgui_overlay, greyblock_mode, greyblock_trigger, demo_mode };
+enum class DebugFlags { imgui_overlay, greyblock_mode, greyblock_trigger, demo_mode, headless };
 struct ServiceProvider {
 	asset::AssetManager assets{};
 	data::DataManager data{*this};
@@ -34,12 +36,18 @@ struct ServiceProvider {
 	audio::MusicPlayer music{};
 	fornani::QuestTracker quest{};
 	fornani::StatTracker stats{};
+	util::JobSystem jobs{};
+	struct {
+		data::WorldSnapshot save_point{}; // what a retry goes back to
+		data::WorldSnapshot room_entry{}; // for rewinding the current room
+	} snapshots{};
 
 	//debug stuff
 	util::Stopwatch stopwatch{};
 
 	[[nodiscard]] auto demo_mode() const -> bool { return debug_flags.test(DebugFlags::demo_mode); }
 	[[nodiscard]] auto greyblock_mode() const -> bool { return debug_flags.test(DebugFlags::greyblock_mode); }
+	[[nodiscard]] auto headless() const -> bool { return debug_flags.test(DebugFlags::headless); }
 	[[nodiscard]] auto death_mode() const -> bool { return state_controller.actions.test(Actions::death_mode); }
 
 };
@@ -3,14 +3,14 @@
 namespace asset {
 
 void AssetManager::import_textures() {
-	t_nani.loadFromFile(finder.resource_path + "/image/character/nani.png");
-	t_portraits.loadFromFile(finder.resource_path + "/image/character/portraits.png");
-	t_bryn.loadFromFile(finder.resource_path + "/image/character/bryn.png");
-	t_gobe.loadFromFile(finder.resource_path + "/image/character/gobe.png");
-	t_dr_go.loadFromFile(finder.resource_path + "/image/character/dr_go.png");
-	t_carl.loadFromFile(finder.resource_path + "/image/character/carl.png");
-	t_mirin.loadFromFile(finder.resource_path + "/image/character/mirin.png");
-	t_bit.loadFromFile(finder.resource_path + "/image/character/bit.png");
+	queue(t_nani, finder.resource_path + "/image/character/nani.png");
+	queue(t_portraits, finder.resource_path + "/image/character/portraits.png");
+	queue(t_bryn, finder.resource_path + "/image/character/bryn.png");
+	queue(t_gobe, finder.resource_path + "/image/character/gobe.png");
+	queue(t_dr_go, finder.resource_path + "/image/character/dr_go.png");
+	queue(t_carl, finder.resource_path + "/image/character/carl.png");
+	queue(t_mirin, finder.resource_path + "/image/character/mirin.png");
+	queue(t_bit, finder.resource_path + "/image/character/bit.png");
 	npcs.insert({"bryn", t_bryn});
 	npcs.insert({"gobe", t_gobe});
 	npcs.insert({"dr_go", t_dr_go});
@@ -18,20 +18,20 @@ void AssetManager::import_textures() {
 	npcs.insert({"mirin", t_mirin});
 	npcs.insert({"bit", t_bit});
 
-	t_palette_nani.loadFromFile(finder.resource_path + "/image/character/nani_palette_default.png");
-	t_palette_nanidiv.loadFromFile(finder.resource_path + "/image/character/nani_palette_divine.png");
-	t_palette_naninight.loadFromFile(finder.resource_path + "/image/character/nani_palette_night.png");
-
-	t_frdog.loadFromFile(finder.resource_path + "/image/critter/frdog.png");
-	t_hulmet.loadFromFile(finder.resource_path + "/image/critter/hulmet.png");
-	t_tank.loadFromFile(finder.resource_path + "/image/critter/tank.png");
-	t_thug.loadFromFile(finder.resource_path + "/image/critter/thug.png");
-	t_eyebot.loadFromFile(finder.resource_path + "/image/critter/eyebot.png");
-	t_eyebit.loadFromFile(finder.resource_path + "/image/critter/eyebit.png");
-	t_minigus.loadFromFile(finder.resource_path + "/image/boss/minigus.png");
-	t_minigus_inv.loadFromFile(finder.resource_path + "/image/boss/minigus_inv.png");
-	t_minigus_red.loadFromFile(finder.resource_path + "/image/boss/minigus_red.png");
-	t_minigus_blue.loadFromFile(finder.resource_path + "/image/boss/minigus_blue.png");
+	queue(t_palette_nani, finder.resource_path + "/image/character/nani_palette_default.png");
+	queue(t_palette_nanidiv, finder.resource_path + "/image/character/nani_palette_divine.png");
+	queue(t_palette_naninight, finder.resource_path + "/image/character/nani_palette_night.png");
+
+	queue(t_frdog, finder.resource_path + "/image/critter/frdog.png");
+	queue(t_hulmet, finder.resource_path + "/image/critter/hulmet.png");
+	queue(t_tank, finder.resource_path + "/image/critter/tank.png");
+	queue(t_thug, finder.resource_path + "/image/critter/thug.png");
+	queue(t_eyebot, finder.resource_path + "/image/critter/eyebot.png");
+	queue(t_eyebit, finder.resource_path + "/image/critter/eyebit.png");
+	queue(t_minigus, finder.resource_path + "/image/boss/minigus.png");
+	queue(t_minigus_inv, finder.resource_path + "/image/boss/minigus_inv.png");
+	queue(t_minigus_red, finder.resource_path + "/image/boss/minigus_red.png");
+	queue(t_minigus_blue, finder.resource_path + "/image/boss/minigus_blue.png");
 	texture_lookup.insert({"frdog", t_frdog});
 	texture_lookup.insert({"hulmet", t_hulmet});
 	texture_lookup.insert({"tank", t_tank});
@@ -40,42 +40,42 @@ void AssetManager::import_textures() {
 	texture_lookup.insert({"eyebit", t_eyebit});
 	texture_lookup.insert({"minigus", t_minigus});
 
-	t_ui.loadFromFile(finder.resource_path + "/image/gui/simple_console.png");
-	t_hud_orb_font.loadFromFile(finder.resource_path + "/image/gui/HUD_orb_font.png");
-	t_hud_hearts.loadFromFile(finder.resource_path + "/image/gui/HUD_hearts.png");
-	t_hud_pointer.loadFromFile(finder.resource_path + "/image/gui/HUD_pointer.png");
-	t_hud_gun_color.loadFromFile(finder.resource_path + "/image/gui/HUD_gun_color.png");
-	t_hud_gun_shadow.loadFromFile(finder.resource_path + "/image/gui/HUD_gun_shadow.png");
-	t_hud_shield.loadFromFile(finder.resource_path + "/image/gui/HUD_shield.png");
-	t_selector.loadFromFile(finder.resource_path + "/image/gui/selector.png");
-	t_console_outline.loadFromFile(finder.resource_path + "/image/gui/console_outline.png");
+	queue(t_ui, finder.resource_path + "/image/gui/simple_console.png");
+	queue(t_hud_orb_font, finder.resource_path + "/image/gui/HUD_orb_font.png");
+	queue(t_hud_hearts, finder.resource_path + "/image/gui/HUD_hearts.png");
+	queue(t_hud_pointer, finder.resource_path + "/image/gui/HUD_pointer.png");
+	queue(t_hud_gun_color, finder.resource_path + "/image/gui/HUD_gun_color.png");
+	queue(t_hud_gun_shadow, finder.resource_path + "/image/gui/HUD_gun_shadow.png");
+	queue(t_hud_shield, finder.resource_path + "/image/gui/HUD_shield.png");
+	queue(t_selector, finder.resource_path + "/image/gui/selector.png");
+	queue(t_console_outline, finder.resource_path + "/image/gui/console_outline.png");
 
 	// guns and bullets!
-	t_bryns_gun.loadFromFile(finder.resource_path + "/image/weapon/bg.png");
-	t_plasmer.loadFromFile(finder.resource_path + "/image/weapon/plasmer.png");
-	t_clover.loadFromFile(finder.resource_path + "/image/weapon/clover.png");
-	t_nova.loadFromFile(finder.resource_path + "/image/weapon/nova.png");
-	t_tomahawk.loadFromFile(finder.resource_path + "/image/weapon/tomahawk.png");
-	t_bryns_gun_projectile.loadFromFile(finder.resource_path + "/image/weapon/bg_proj.png");
-	t_plasmer_projectile.loadFromFile(finder.resource_path + "/image/weapon/plasmer_proj.png");
-	t_clover_projectile.loadFromFile(finder.resource_path + "/image/weapon/clover_proj.png");
-	t_nova_projectile.loadFromFile(finder.resource_path + "/image/weapon/nova_proj.png");
-	t_skycorps_ar_projectile.loadFromFile(finder.resource_path + "/image/weapon/skycorps_ar_proj.png");
-	t_tomahawk_projectile.loadFromFile(finder.resource_path + "/image/weapon/tomahawk_projectile.png");
-	t_grappling_hook.loadFromFile(finder.resource_path + "/image/weapon/grappling_hook.png");
-	t_rope.loadFromFile(finder.resource_path + "/image/weapon/rope.png");
-	t_hook.loadFromFile(finder.resource_path + "/image/weapon/hook.png");
-	t_grenade_launcher.loadFromFile(finder.resource_path + "/image/weapon/grenade_launcher.png");
-	t_grenade.loadFromFile(finder.resource_path + "/image/weapon/grenade.png");
-	t_minigun.loadFromFile(finder.resource_path + "/image/boss/minigun.png");
-	t_soda_gun.loadFromFile(finder.resource_path + "/image/weapon/soda_gun.png");
-	t_soda_gun_projectile.loadFromFile(finder.resource_path + "/image/weapon/soda.png");
-	t_staple_gun.loadFromFile(finder.resource_path + "/image/weapon/staple_gun.png");
-	t_staple.loadFromFile(finder.resource_path + "/image/weapon/staple.png");
-	t_indie.loadFromFile(finder.resource_path + "/image/weapon/indie.png");
-	t_indie_projectile.loadFromFile(finder.resource_path + "/image/weapon/indie_proj.png");
-	t_gnat.loadFromFile(finder.resource_path + "/image/weapon/gnat.png");
-	t_gnat_projectile.loadFromFile(finder.resource_path + "/image/weapon/gnat_proj.png");
+	queue(t_bryns_gun, finder.resource_path + "/image/weapon/bg.png");
+	queue(t_plasmer, finder.resource_path + "/image/weapon/plasmer.png");
+	queue(t_clover, finder.resource_path + "/image/weapon/clover.png");
+	queue(t_nova, finder.resource_path + "/image/weapon/nova.png");
+	queue(t_tomahawk, finder.resource_path + "/image/weapon/tomahawk.png");
+	queue(t_bryns_gun_projectile, finder.resource_path + "/image/weapon/bg_proj.png");
+	queue(t_plasmer_projectile, finder.resource_path + "/image/weapon/plasmer_proj.png");
+	queue(t_clover_projectile, finder.resource_path + "/image/weapon/clover_proj.png");
+	queue(t_nova_projectile, finder.resource_path + "/image/weapon/nova_proj.png");
+	queue(t_skycorps_ar_projectile, finder.resource_path + "/image/weapon/skycorps_ar_proj.png");
+	queue(t_tomahawk_projectile, finder.resource_path + "/image/weapon/tomahawk_projectile.png");
+	queue(t_grappling_hook, finder.resource_path + "/image/weapon/grappling_hook.png");
+	queue(t_rope, finder.resource_path + "/image/weapon/rope.png");
+	queue(t_hook, finder.resource_path + "/image/weapon/hook.png");
+	queue(t_grenade_launcher, finder.resource_path + "/image/weapon/grenade_launcher.png");
+	queue(t_grenade, finder.resource_path + "/image/weapon/grenade.png");
+	queue(t_minigun, finder.resource_path + "/image/boss/minigun.png");
+	queue(t_soda_gun, finder.resource_path + "/image/weapon/soda_gun.png");
+	queue(t_soda_gun_projectile, finder.resource_path + "/image/weapon/soda.png");
+	queue(t_staple_gun, finder.resource_path + "/image/weapon/staple_gun.png");
+	queue(t_staple, finder.resource_path + "/image/weapon/staple.png");
+	queue(t_indie, finder.resource_path + "/image/weapon/indie.png");
+	queue(t_indie_projectile, finder.resource_path + "/image/weapon/indie_proj.png");
+	queue(t_gnat, finder.resource_path + "/image/weapon/gnat.png");
+	queue(t_gnat_projectile, finder.resource_path + "/image/weapon/gnat_proj.png");
 
 	weapon_textures.insert({"bryn's gun", t_bryns_gun});
 	projectile_textures.insert({"bryn's gun", t_bryns_gun_projectile});
@@ -104,51 +104,51 @@ void AssetManager::import_textures() {
 	weapon_textures.insert({"gnat", t_gnat});
 	projectile_textures.insert({"gnat", t_gnat_projectile});
 
-	t_items.loadFromFile(finder.resource_path + "/image/item/items.png");
-	t_guns.loadFromFile(finder.resource_path + "/image/item/guns.png");
-	t_shield.loadFromFile(finder.resource_path + "/image/entity/shield.png");
+	queue(t_items, finder.resource_path + "/image/item/items.png");
+	queue(t_guns, finder.resource_path + "/image/item/guns.png");
+	queue(t_shield, finder.resource_path + "/image/entity/shield.png");
 
-	t_heart.loadFromFile(finder.resource_path + "/image/item/hearts.png");
-	t_orb.loadFromFile(finder.resource_path + "/image/item/orbs.png");
+	queue(t_heart, finder.resource_path + "/image/item/hearts.png");
+	queue(t_orb, finder.resource_path + "/image/item/orbs.png");
 
-	t_fader.loadFromFile(finder.resource_path + "/image/vfx/fader.png");
+	queue(t_fader, finder.resource_path + "/image/vfx/fader.png");
 
-	t_twinkle.loadFromFile(finder.resource_path + "/image/vfx/twinkle.png");
-	t_small_flash.loadFromFile(finder.resource_path + "/image/vfx/small_flash.png");
+	queue(t_twinkle, finder.resource_path + "/image/vfx/twinkle.png");
+	queue(t_small_flash, finder.resource_path + "/image/vfx/small_flash.png");
 	particle_textures.insert({"twinkle", t_twinkle});
 
-	t_alphabet.loadFromFile(finder.resource_path + "/image/gui/alphabet.png");
+	queue(t_alphabet, finder.resource_path + "/image/gui/alphabet.png");
 
-	t_platforms.loadFromFile(finder.resource_path + "/image/tile/platforms.png");
-	t_platform_night.loadFromFile(finder.resource_path + "/image/tile/platform_night.png");
-	t_platform_abandoned.loadFromFile(finder.resource_path + "/image/tile/platform_abandoned.png");
-	t_platform_firstwind.loadFromFile(finder.resource_path + "/image/tile/platform_firstwind.png");
-	t_platform_overturned.loadFromFile(finder.resource_path + "/image/tile/platform_overturned.png");
+	queue(t_platforms, finder.resource_path + "/image/tile/platforms.png");
+	queue(t_platform_night, finder.resource_path + "/image/tile/platform_night.png");
+	queue(t_platform_abandoned, finder.resource_path + "/image/tile/platform_abandoned.png");
+	queue(t_platform_firstwind, finder.resource_path + "/image/tile/platform_firstwind.png");
+	queue(t_platform_overturned, finder.resource_path + "/image/tile/platform_overturned.png");
 	platform_lookup.insert({0, t_platform_night});
 	platform_lookup.insert({1, t_platform_abandoned});
 	platform_lookup.insert({2, t_platform_firstwind});
 	platform_lookup.insert({3, t_platform_overturned});
-	t_automatic_animators_firstwind.loadFromFile(finder.resource_path + "/image/tile/automatic_animators_firstwind.png");
+	queue(t_automatic_animators_firstwind, finder.resource_path + "/image/tile/automatic_animators_firstwind.png");
 	animator_lookup.insert({0, t_automatic_animators_firstwind});
 
-	t_breakables.loadFromFile(finder.resource_path + "/image/tile/breakables.png");
-	t_pushables.loadFromFile(finder.resource_path + "/image/tile/pushables.png");
-	t_inspectable.loadFromFile(finder.resource_path + "/image/entity/inspectable.png");
-	t_switches.loadFromFile(finder.resource_path + "/image/tile/switches.png");
-	t_switch_blocks.loadFromFile(finder.resource_path + "/image/tile/switch_blocks.png");
-	t_indicator.loadFromFile(finder.resource_path + "/image/entity/arrow.png");
+	queue(t_breakables, finder.resource_path + "/image/tile/breakables.png");
+	queue(t_pushables, finder.resource_path + "/image/tile/pushables.png");
+	queue(t_inspectable, finder.resource_path + "/image/entity/inspectable.png");
+	queue(t_switches, finder.resource_path + "/image/tile/switches.png");
+	queue(t_switch_blocks, finder.resource_path + "/image/tile/switch_blocks.png");
+	queue(t_indicator, finder.resource_path + "/image/entity/arrow.png");
 
 	// backgrounds
-	t_bg_dusk.loadFromFile(finder.resource_path + "/image/background/dusk.png");
-	t_bg_opensky.loadFromFile(finder.resource_path + "/image/background/opensky.png");
-	t_bg_overcast.loadFromFile(finder.resource_path + "/image/background/overcast.png");
-	t_bg_night.loadFromFile(finder.resource_path + "/image/background/night.png");
-	t_bg_dawn.loadFromFile(finder.resource_path + "/image/background/dawn.png");
-	t_bg_sunrise.loadFromFile(finder.resource_path + "/image/background/sunrise.png");
-	t_bg_rosyhaze.loadFromFile(finder.resource_path + "/image/background/rosyhaze.png");
-	t_bg_slime.loadFromFile(finder.resource_path + "/image/background/slime.png");
-	t_bg_dirt.loadFromFile(finder.resource_path + "/image/background/dirt.png");
-	t_bg_grove.loadFromFile(finder.resource_path + "/image/background/glade.png");
+	queue(t_bg_dusk, finder.resource_path + "/image/background/dusk.png");
+	queue(t_bg_opensky, finder.resource_path + "/image/background/opensky.png");
+	queue(t_bg_overcast, finder.resource_path + "/image/background/overcast.png");
+	queue(t_bg_night, finder.resource_path + "/image/background/night.png");
+	queue(t_bg_dawn, finder.resource_path + "/image/background/dawn.png");
+	queue(t_bg_sunrise, finder.resource_path + "/image/background/sunrise.png");
+	queue(t_bg_rosyhaze, finder.resource_path + "/image/background/rosyhaze.png");
+	queue(t_bg_slime, finder.resource_path + "/image/background/slime.png");
+	queue(t_bg_dirt, finder.resource_path + "/image/background/dirt.png");
+	queue(t_bg_grove, finder.resource_path + "/image/background/glade.png");
 
 	background_lookup.insert({0, t_bg_dusk});
 	background_lookup.insert({1, t_bg_sunrise});
@@ -169,20 +169,20 @@ void AssetManager::import_textures() {
 	background_lookup.insert({16, t_bg_deep});
 	background_lookup.insert({17, t_bg_grove});
 
-	t_large_animators.loadFromFile(finder.resource_path + "/image/animators/large_animators_01.png");
-	t_small_animators.loadFromFile(finder.resource_path + "/image/animators/small_animators_01.png");
-
-	t_huge_explosion.loadFromFile(finder.resource_path + "/image/entity/huge_explosion.png");
-	t_large_explosion.loadFromFile(finder.resource_path + "/image/entity/large_explosion.png");
-	t_small_explosion.loadFromFile(finder.resource_path + "/image/entity/small_explosion.png");
-	t_wall_hit.loadFromFile(finder.resource_path + "/image/entity/wall_hit.png");
-	t_mini_flash.loadFromFile(finder.resource_path + "/image/entity/small_flash.png");
-	t_medium_flash.loadFromFile(finder.resource_path + "/image/entity/medium_flash.png");
-	t_inv_hit.loadFromFile(finder.resource_path + "/image/entity/inv_hit.png");
-	t_puff.loadFromFile(finder.resource_path + "/image/entity/puff.png");
-	t_bullet_hit.loadFromFile(finder.resource_path + "/image/entity/bullet_hit.png");
-	t_doublejump.loadFromFile(finder.resource_path + "/image/entity/doublejump.png");
-	t_dust.loadFromFile(finder.resource_path + "/image/entity/dust.png");
+	queue(t_large_animators, finder.resource_path + "/image/animators/large_animators_01.png");
+	queue(t_small_animators, finder.resource_path + "/image/animators/small_animators_01.png");
+
+	queue(t_huge_explosion, finder.resource_path + "/image/entity/huge_explosion.png");
+	queue(t_large_explosion, finder.resource_path + "/image/entity/large_explosion.png");
+	queue(t_small_explosion, finder.resource_path + "/image/entity/small_explosion.png");
+	queue(t_wall_hit, finder.resource_path + "/image/entity/wall_hit.png");
+	queue(t_mini_flash, finder.resource_path + "/image/entity/small_flash.png");
+	queue(t_medium_flash, finder.resource_path + "/image/entity/medium_flash.png");
+	queue(t_inv_hit, finder.resource_path + "/image/entity/inv_hit.png");
+	queue(t_puff, finder.resource_path + "/image/entity/puff.png");
+	queue(t_bullet_hit, finder.resource_path + "/image/entity/bullet_hit.png");
+	queue(t_doublejump, finder.resource_path + "/image/entity/doublejump.png");
+	queue(t_dust, finder.resource_path + "/image/entity/dust.png");
 	effect_lookup.insert({0, t_small_explosion});
 	effect_lookup.insert({1, t_large_explosion});
 	effect_lookup.insert({2, t_wall_hit});
@@ -196,7 +196,7 @@ void AssetManager::import_textures() {
 	effect_lookup.insert({10, t_dust});
 
 	// title stuff
-	t_title.loadFromFile(finder.resource_path + "/image/gui/title.png");
+	queue(t_title, finder.resource_path + "/image/gui/title.png");
 
 	// load all the other textures...
 
@@ -205,175 +205,213 @@ void AssetManager::import_textures() {
 		char const* next = lookup::get_style_string.at(lookup::get_style.at(i));
 		styles[i] = next;
 	}
+	tilesets.resize(lookup::NUM_STYLES); // sized up front, since the queue holds pointers into it
 	for (int i = 0; i < lookup::NUM_STYLES; ++i) {
-		tilesets.push_back(sf::Texture());
 		std::string style = lookup::get_style_string.at(lookup::get_style.at(i));
-		tilesets.back().loadFromFile(finder.resource_path + "/image/tile/" + style + "_tiles.png");
+		queue(tilesets.at(i), finder.resource_path + "/image/tile/" + style + "_tiles.png");
 	}
 
-	savepoint.loadFromFile(finder.resource_path + "/image/entity/savepoint.png");
-	t_chest.loadFromFile(finder.resource_path + "/image/entity/chest.png");
+	queue(savepoint, finder.resource_path + "/image/entity/savepoint.png");
+	queue(t_chest, finder.resource_path + "/image/entity/chest.png");
 }
 
 void AssetManager::load_audio() {
-	click_buffer.loadFromFile(finder.resource_path + "/audio/sfx/heavy_click.wav");
-	click.setBuffer(click_buffer);
-	sharp_click_buffer.loadFromFile(finder.resource_path + "/audio/sfx/click.wav");
-	sharp_click.setBuffer(sharp_click_buffer);
-	menu_shift_buffer.loadFromFile(finder.resource_path + "/audio/sfx/menu_shift_1.wav");
-	menu_shift.setBuffer(menu_shift_buffer);
-	menu_back_buffer.loadFromFile(finder.resource_path + "/audio/sfx/menu_shift_2.wav");
-	menu_back.setBuffer(menu_back_buffer);
-	menu_next_buffer.loadFromFile(finder.resource_path + "/audio/sfx/menu_shift_3.wav");
-	menu_next.setBuffer(menu_next_buffer);
-	menu_open_buffer.loadFromFile(finder.resource_path + "/audio/sfx/gui_upward_select.wav");
-	menu_open.setBuffer(menu_open_buffer);
-	sharp_click_buffer.loadFromFile(finder.resource_path + "/audio/sfx/click.wav");
-	sharp_click.setBuffer(sharp_click_buffer);
-	arms_switch_buffer.loadFromFile(finder.resource_path + "/audio/sfx/arms_switch.wav");
-	arms_switch.setBuffer(arms_switch_buffer);
-	bg_shot_buffer.loadFromFile(finder.resource_path + "/audio/sfx/bg_shot.wav");
-	bg_shot.setBuffer(bg_shot_buffer);
-	skycorps_ar_buffer.loadFromFile(finder.resource_path + "/audio/sfx/skycorps_ar_shot.wav");
-	skycorps_ar_shot.setBuffer(skycorps_ar_buffer);
-	plasmer_shot_buffer.loadFromFile(finder.resource_path + "/audio/sfx/plasmer_shot.wav");
-	plasmer_shot.setBuffer(plasmer_shot_buffer);
-	tomahawk_flight_buffer.loadFromFile(finder.resource_path + "/audio/sfx/tomahawk_flight.wav");
-	tomahawk_flight.setBuffer(tomahawk_flight_buffer);
-	tomahawk_catch_buffer.loadFromFile(finder.resource_path + "/audio/sfx/tomahawk_catch.wav");
-	tomahawk_catch.setBuffer(tomahawk_catch_buffer);
-	pop_mid_buffer.loadFromFile(finder.resource_path + "/audio/sfx/clover.wav");
-	pop_mid.setBuffer(pop_mid_buffer);
-	b_nova.loadFromFile(finder.resource_path + "/audio/sfx/nova_shot.wav");
-	nova_shot.setBuffer(b_nova);
-	b_staple.loadFromFile(finder.resource_path + "/audio/sfx/staple.wav");
-	staple.setBuffer(b_staple);
-	b_gnat.loadFromFile(finder.resource_path + "/audio/sfx/gnat.wav");
-	gnat.setBuffer(b_gnat);
-	jump_buffer.loadFromFile(finder.resource_path + "/audio/sfx/jump.wav");
-	jump.setBuffer(jump_buffer);
-
-	shatter_buffer.loadFromFile(finder.resource_path + "/audio/sfx/shatter.wav");
-	shatter.setBuffer(shatter_buffer);
-	step_buffer.loadFromFile(finder.resource_path + "/audio/sfx/steps.wav");
-	step.setBuffer(step_buffer);
-	landed_buffer.loadFromFile(finder.resource_path + "/audio/sfx/landed.wav");
-	landed.setBuffer(landed_buffer);
-	hurt_buffer.loadFromFile(finder.resource_path + "/audio/sfx/hurt.wav");
-	hurt.setBuffer(hurt_buffer);
-	player_death_buffer.loadFromFile(finder.resource_path + "/audio/sfx/player_death.wav");
-	player_death.setBuffer(player_death_buffer);
-	enem_hit_buffer.loadFromFile(finder.resource_path + "/audio/sfx/enemy/hit_medium.wav");
-	enem_hit.setBuffer(enem_hit_buffer);
-	bubble_buffer.loadFromFile(finder.resource_path + "/audio/sfx/mid_pop.wav");
-	bubble.setBuffer(bubble_buffer);
-
-	enem_death_1_buffer.loadFromFile(finder.resource_path + "/audio/sfx/enemy_death.wav");
-	enem_death_1.setBuffer(enem_death_1_buffer);
-
-	heal_buffer.loadFromFile(finder.resource_path + "/audio/sfx/heal.wav");
-	heal.setBuffer(heal_buffer);
-	b_health_increase.loadFromFile(finder.resource_path + "/audio/sfx/health_increase.wav");
-	health_increase.setBuffer(b_health_increase);
-	orb_1_buffer.loadFromFile(finder.resource_path + "/audio/sfx/orb_1.wav");
-	orb_1.setBuffer(orb_1_buffer);
-	orb_2_buffer.loadFromFile(finder.resource_path + "/audio/sfx/orb_2.wav");
-	orb_2.setBuffer(orb_2_buffer);
-	orb_3_buffer.loadFromFile(finder.resource_path + "/audio/sfx/orb_3.wav");
-	orb_3.setBuffer(orb_3_buffer);
-	orb_4_buffer.loadFromFile(finder.resource_path + "/audio/sfx/orb_4.wav");
-	orb_4.setBuffer(orb_4_buffer);
-
-	tank_alert1_buffer.loadFromFile(finder.resource_path + "/audio/sfx/tank_alert_1.wav");
-	tank_alert_1.setBuffer(tank_alert1_buffer);
-	tank_alert2_buffer.loadFromFile(finder.resource_path + "/audio/sfx/tank_alert_2.wav");
-	tank_alert_2.setBuffer(tank_alert2_buffer);
-	tank_hurt1_buffer.loadFromFile(finder.resource_path + "/audio/sfx/tank_hurt_1.wav");
-	tank_hurt_1.setBuffer(tank_hurt1_buffer);
-	tank_hurt2_buffer.loadFromFile(finder.resource_path + "/audio/sfx/tank_hurt_2.wav");
-	tank_hurt_2.setBuffer(tank_hurt2_buffer);
-	tank_death_buffer.loadFromFile(finder.resource_path + "/audio/sfx/tank_death.wav");
-	tank_death.setBuffer(tank_death_buffer);
+	sounds = std::make_unique<Sounds>();
+	queue(click_buffer, finder.resource_path + "/audio/sfx/heavy_click.wav");
+	sounds->click.setBuffer(click_buffer);
+	queue(sharp_click_buffer, finder.resource_path + "/audio/sfx/click.wav");
+	sounds->sharp_click.setBuffer(sharp_click_buffer);
+	queue(menu_shift_buffer, finder.resource_path + "/audio/sfx/menu_shift_1.wav");
+	sounds->menu_shift.setBuffer(menu_shift_buffer);
+	queue(menu_back_buffer, finder.resource_path + "/audio/sfx/menu_shift_2.wav");
+	sounds->menu_back.setBuffer(menu_back_buffer);
+	queue(menu_next_buffer, finder.resource_path + "/audio/sfx/menu_shift_3.wav");
+	sounds->menu_next.setBuffer(menu_next_buffer);
+	queue(menu_open_buffer, finder.resource_path + "/audio/sfx/gui_upward_select.wav");
+	sounds->menu_open.setBuffer(menu_open_buffer);
+	queue(arms_switch_buffer, finder.resource_path + "/audio/sfx/arms_switch.wav");
+	sounds->arms_switch.setBuffer(arms_switch_buffer);
+	queue(bg_shot_buffer, finder.resource_path + "/audio/sfx/bg_shot.wav");
+	sounds->bg_shot.setBuffer(bg_shot_buffer);
+	queue(skycorps_ar_buffer, finder.resource_path + "/audio/sfx/skycorps_ar_shot.wav");
+	sounds->skycorps_ar_shot.setBuffer(skycorps_ar_buffer);
+	queue(plasmer_shot_buffer, finder.resource_path + "/audio/sfx/plasmer_shot.wav");
+	sounds->plasmer_shot.setBuffer(plasmer_shot_buffer);
+	queue(tomahawk_flight_buffer, finder.resource_path + "/audio/sfx/tomahawk_flight.wav");
+	sounds->tomahawk_flight.setBuffer(tomahawk_flight_buffer);
+	queue(tomahawk_catch_buffer, finder.resource_path + "/audio/sfx/tomahawk_catch.wav");
+	sounds->tomahawk_catch.setBuffer(tomahawk_catch_buffer);
+	queue(pop_mid_buffer, finder.resource_path + "/audio/sfx/clover.wav");
+	sounds->pop_mid.setBuffer(pop_mid_buffer);
+	queue(b_nova, finder.resource_path + "/audio/sfx/nova_shot.wav");
+	sounds->nova_shot.setBuffer(b_nova);
+	queue(b_staple, finder.resource_path + "/audio/sfx/staple.wav");
+	sounds->staple.setBuffer(b_staple);
+	queue(b_gnat, finder.resource_path + "/audio/sfx/gnat.wav");
+	sounds->gnat.setBuffer(b_gnat);
+	queue(jump_buffer, finder.resource_path + "/audio/sfx/jump.wav");
+	sounds->jump.setBuffer(jump_buffer);
+
+	queue(shatter_buffer, finder.resource_path + "/audio/sfx/shatter.wav");
+	sounds->shatter.setBuffer(shatter_buffer);
+	queue(step_buffer, finder.resource_path + "/audio/sfx/steps.wav");
+	sounds->step.setBuffer(step_buffer);
+	queue(landed_buffer, finder.resource_path + "/audio/sfx/landed.wav");
+	sounds->landed.setBuffer(landed_buffer);
+	queue(hurt_buffer, finder.resource_path + "/audio/sfx/hurt.wav");
+	sounds->hurt.setBuffer(hurt_buffer);
+	queue(player_death_buffer, finder.resource_path + "/audio/sfx/player_death.wav");
+	sounds->player_death.setBuffer(player_death_buffer);
+	queue(enem_hit_buffer, finder.resource_path + "/audio/sfx/enemy/hit_medium.wav");
+	sounds->enem_hit.setBuffer(enem_hit_buffer);
+	queue(bubble_buffer, finder.resource_path + "/audio/sfx/mid_pop.wav");
+	sounds->bubble.setBuffer(bubble_buffer);
+
+	queue(enem_death_1_buffer, finder.resource_path + "/audio/sfx/enemy_death.wav");
+	sounds->enem_death_1.setBuffer(enem_death_1_buffer);
+
+	queue(heal_buffer, finder.resource_path + "/audio/sfx/heal.wav");
+	sounds->heal.setBuffer(heal_buffer);
+	queue(b_health_increase, finder.resource_path + "/audio/sfx/health_increase.wav");
+	sounds->health_increase.setBuffer(b_health_increase);
+	queue(orb_1_buffer, finder.resource_path + "/audio/sfx/orb_1.wav");
+	sounds->orb_1.setBuffer(orb_1_buffer);
+	queue(orb_2_buffer, finder.resource_path + "/audio/sfx/orb_2.wav");
+	sounds->orb_2.setBuffer(orb_2_buffer);
+	queue(orb_3_buffer, finder.resource_path + "/audio/sfx/orb_3.wav");
+	sounds->orb_3.setBuffer(orb_3_buffer);
+	queue(orb_4_buffer, finder.resource_path + "/audio/sfx/orb_4.wav");
+	sounds->orb_4.setBuffer(orb_4_buffer);
+
+	queue(tank_alert1_buffer, finder.resource_path + "/audio/sfx/tank_alert_1.wav");
+	sounds->tank_alert_1.setBuffer(tank_alert1_buffer);
+	queue(tank_alert2_buffer, finder.resource_path + "/audio/sfx/tank_alert_2.wav");
+	sounds->tank_alert_2.setBuffer(tank_alert2_buffer);
+	queue(tank_hurt1_buffer, finder.resource_path + "/audio/sfx/tank_hurt_1.wav");
+	sounds->tank_hurt_1.setBuffer(tank_hurt1_buffer);
+	queue(tank_hurt2_buffer, finder.resource_path + "/audio/sfx/tank_hurt_2.wav");
+	sounds->tank_hurt_2.setBuffer(tank_hurt2_buffer);
+	queue(tank_death_buffer, finder.resource_path + "/audio/sfx/tank_death.wav");
+	sounds->tank_death.setBuffer(tank_death_buffer);
 
 	// minigus
 
-	b_minigus_laugh.loadFromFile(finder.resource_path + "/audio/sfx/minigus/minigus_laugh.wav");
-	b_minigus_laugh_2.loadFromFile(finder.resource_path + "/audio/sfx/minigus/minigus_laugh_2.wav");
-	b_minigus_hurt_1.loadFromFile(finder.resource_path + "/audio/sfx/minigus/minigus_hurt.wav");
-	b_minigus_hurt_2.loadFromFile(finder.resource_path + "/audio/sfx/minigus/minigus_hurt_2.wav");
-	b_minigus_hurt_3.loadFromFile(finder.resource_path + "/audio/sfx/minigus/minigus_hurt_3.wav");
-	b_minigus_grunt.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_grunt.wav");
-	b_minigus_aww.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_aww.wav");
-	b_minigus_babyimhome.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_babyimhome.wav");
-	b_minigus_deepspeak.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_deepspeak.wav");
-	b_minigus_doge.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_doge.wav");
-	b_minigus_dontlookatme.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_dontlookatme.wav");
-	b_minigus_exhale.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_exhale.wav");
-	b_minigus_getit.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_getit.wav");
-	b_minigus_greatidea.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_greatidea.wav");
-	b_minigus_itsagreatday.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_itsagreatday.wav");
-	b_minigus_long_death.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_long_death.wav");
-	b_minigus_long_moan.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_long_moan.wav");
-	b_minigus_momma.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_momma.wav");
-	b_minigus_mother.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_mother.wav");
-	b_minigus_ok_1.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_ok.wav");
-	b_minigus_ok_2.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_okayyy.wav");
-	b_minigus_pizza.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_pizza.wav");
-	b_minigus_poh.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_poh.wav");
-	b_minigus_quick_breath.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_quick_breath.wav");
-	b_minigus_thatisverysneeze.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_thatisverysneeze.wav");
-	b_minigus_whatisit.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_whatisit.wav");
-	b_minigus_woob.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_woob.wav");
-
-	b_mirin_ah.loadFromFile(finder.resource_path + "/audio/sfx/mirin/mirin_ah.wav");
-	b_mirin_oh.loadFromFile(finder.resource_path + "/audio/sfx/mirin/mirin_oh.wav");
-	b_mirin_laugh.loadFromFile(finder.resource_path + "/audio/sfx/mirin/mirin_laugh.wav");
+	queue(b_minigus_laugh, finder.resource_path + "/audio/sfx/minigus/minigus_laugh.wav");
+	queue(b_minigus_laugh_2, finder.resource_path + "/audio/sfx/minigus/minigus_laugh_2.wav");
+	queue(b_minigus_hurt_1, finder.resource_path + "/audio/sfx/minigus/minigus_hurt.wav");
+	queue(b_minigus_hurt_2, finder.resource_path + "/audio/sfx/minigus/minigus_hurt_2.wav");
+	queue(b_minigus_hurt_3, finder.resource_path + "/audio/sfx/minigus/minigus_hurt_3.wav");
+	queue(b_minigus_grunt, finder.resource_path + "/audio/sfx/minigus/mg_grunt.wav");
+	queue(b_minigus_aww, finder.resource_path + "/audio/sfx/minigus/mg_aww.wav");
+	queue(b_minigus_babyimhome, finder.resource_path + "/audio/sfx/minigus/mg_babyimhome.wav");
+	queue(b_minigus_deepspeak, finder.resource_path + "/audio/sfx/minigus/mg_deepspeak.wav");
+	queue(b_minigus_doge, finder.resource_path + "/audio/sfx/minigus/mg_doge.wav");
+	queue(b_minigus_dontlookatme, finder.resource_path + "/audio/sfx/minigus/mg_dontlookatme.wav");
+	queue(b_minigus_exhale, finder.resource_path + "/audio/sfx/minigus/mg_exhale.wav");
+	queue(b_minigus_getit, finder.resource_path + "/audio/sfx/minigus/mg_getit.wav");
+	queue(b_minigus_greatidea, finder.resource_path + "/audio/sfx/minigus/mg_greatidea.wav");
+	queue(b_minigus_itsagreatday, finder.resource_path + "/audio/sfx/minigus/mg_itsagreatday.wav");
+	queue(b_minigus_long_death, finder.resource_path + "/audio/sfx/minigus/mg_long_death.wav");
+	queue(b_minigus_long_moan, finder.resource_path + "/audio/sfx/minigus/mg_long_moan.wav");
+	queue(b_minigus_momma, finder.resource_path + "/audio/sfx/minigus/mg_momma.wav");
+	queue(b_minigus_mother, finder.resource_path + "/audio/sfx/minigus/mg_mother.wav");
+	queue(b_minigus_ok_1, finder.resource_path + "/audio/sfx/minigus/mg_ok.wav");
+	queue(b_minigus_ok_2, finder.resource_path + "/audio/sfx/minigus/mg_okayyy.wav");
+	queue(b_minigus_pizza, finder.resource_path + "/audio/sfx/minigus/mg_pizza.wav");
+	queue(b_minigus_poh, finder.resource_path + "/audio/sfx/minigus/mg_poh.wav");
+	queue(b_minigus_quick_breath, finder.resource_path + "/audio/sfx/minigus/mg_quick_breath.wav");
+	queue(b_minigus_thatisverysneeze, finder.resource_path + "/audio/sfx/minigus/mg_thatisverysneeze.wav");
+	queue(b_minigus_whatisit, finder.resource_path + "/audio/sfx/minigus/mg_whatisit.wav");
+	queue(b_minigus_woob, finder.resource_path + "/audio/sfx/minigus/mg_woob.wav");
+
+	queue(b_mirin_ah, finder.resource_path + "/audio/sfx/mirin/mirin_ah.wav");
+	queue(b_mirin_oh, finder.resource_path + "/audio/sfx/mirin/mirin_oh.wav");
+	queue(b_mirin_laugh, finder.resource_path + "/audio/sfx/mirin/mirin_laugh.wav");
+
+	queue(b_heavy_land, finder.resource_path + "/audio/sfx/deep/heavy_land.wav");
+	queue(b_delay_crash, finder.resource_path + "/audio/sfx/deep/delay_crash.wav");
+	queue(b_delay_high, finder.resource_path + "/audio/sfx/deep/delay_high.wav");
+	queue(b_laser, finder.resource_path + "/audio/sfx/laser1.wav");
+	queue(b_gun_charge, finder.resource_path + "/audio/sfx/gun_charge.wav");
+	queue(b_minigus_build, finder.resource_path + "/audio/sfx/minigus/mg_build.wav");
+	queue(b_minigus_invincibility, finder.resource_path + "/audio/sfx/minigus/mg_inv.wav");
+	queue(b_soda, finder.resource_path + "/audio/sfx/soda.wav");
+	queue(b_breakable_hit, finder.resource_path + "/audio/sfx/breakable_hit.wav");
+
+	queue(b_enemy_hit_low, finder.resource_path + "/audio/sfx/enemy/hit_low.wav");
+	queue(b_enemy_hit_medium, finder.resource_path + "/audio/sfx/enemy/hit_medium.wav");
+	queue(b_enemy_hit_high, finder.resource_path + "/audio/sfx/enemy/hit_high.wav");
+	queue(b_enemy_hit_squeak, finder.resource_path + "/audio/sfx/enemy/hit_squeak.wav");
+	queue(b_enemy_hit_inv, finder.resource_path + "/audio/sfx/enemy/hit_inv.wav");
+	queue(b_wall_hit, finder.resource_path + "/audio/sfx/wall_hit.wav");
+	queue(b_thud, finder.resource_path + "/audio/sfx/thud.wav");
+	queue(b_small_crash, finder.resource_path + "/audio/sfx/small_crash.wav");
+	queue(b_heavy_move, finder.resource_path + "/audio/sfx/heavy_move.wav");
+	sounds->hard_hit.setBuffer(b_enemy_hit_inv);
+	sounds->wall_hit.setBuffer(b_wall_hit);
+	sounds->thud.setBuffer(b_thud);
+	sounds->small_crash.setBuffer(b_small_crash);
+	sounds->heavy_move.setBuffer(b_heavy_move);
+
+	queue(save_buffer, finder.resource_path + "/audio/sfx/save_point.wav");
+	sounds->save.setBuffer(save_buffer);
+	queue(load_buffer, finder.resource_path + "/audio/sfx/load_game.wav");
+	sounds->load.setBuffer(load_buffer);
+	queue(soft_sparkle_high_buffer, finder.resource_path + "/audio/sfx/soft_sparkle_high.wav");
+	sounds->soft_sparkle_high.setBuffer(soft_sparkle_high_buffer);
+	queue(soft_sparkle_buffer, finder.resource_path + "/audio/sfx/soft_sparkle.wav");
+	sounds->soft_sparkle.setBuffer(soft_sparkle_buffer);
+	queue(chest_buffer, finder.resource_path + "/audio/sfx/chest.wav");
+	queue(b_switch_press, finder.resource_path + "/audio/sfx/switch_press.wav");
+	queue(b_block_toggle, finder.resource_path + "/audio/sfx/block_toggle.wav");
+	sounds->chest.setBuffer(chest_buffer);
+	sounds->breakable_hit.setBuffer(b_breakable_hit);
+	sounds->breakable_shatter.setBuffer(shatter_buffer);
+	sounds->switch_press.setBuffer(b_switch_press);
+	sounds->block_toggle.setBuffer(b_block_toggle);
+}
+
+auto AssetManager::decode_texture(std::size_t i) -> std::string_view {
+	auto& pending = pending_textures.at(i);
+	pending.decoded = pending.image.loadFromFile(pending.path);
+	return std::string_view{pending.path}.substr(finder.resource_path.size() + 1);
+}
+
+auto AssetManager::decode_sound(std::size_t i) -> std::string_view {
+	auto& pending = pending_sounds.at(i);
+	auto file = sf::InputSoundFile{};
+	if (file.openFromFile(pending.path)) {
+		pending.samples.resize(static_cast<std::size_t>(file.getSampleCount()));
+		pending.samples.resize(static_cast<std::size_t>(file.read(pending.samples.data(), pending.samples.size())));
+		pending.channels = file.getChannelCount();
+		pending.sample_rate = file.getSampleRate();
+		pending.decoded = true;
+	}
+	return std::string_view{pending.path}.substr(finder.resource_path.size() + 1);
+}
+
+void AssetManager::upload_textures() {
+	for (auto& pending : pending_textures) {
+		if (pending.decoded) { pending.texture->loadFromImage(pending.image); }
+	}
+	pending_textures.clear();
+}
+
+void AssetManager::upload_sounds() {
+	for (auto& pending : pending_sounds) {
+		if (pending.decoded) { pending.buffer->loadFromSamples(pending.samples.data(), pending.samples.size(), pending.channels, pending.sample_rate); }
+	}
+	pending_sounds.clear();
+	// npc voices are copies, so they are taken once the buffers hold samples
+	vs_mirin.clear();
 	vs_mirin.push_back(b_mirin_ah);
 	vs_mirin.push_back(b_mirin_oh);
 	vs_mirin.push_back(b_mirin_laugh);
-	npc_sounds.insert({"mirin", vs_mirin});
-
-	b_heavy_land.loadFromFile(finder.resource_path + "/audio/sfx/deep/heavy_land.wav");
-	b_delay_crash.loadFromFile(finder.resource_path + "/audio/sfx/deep/delay_crash.wav");
-	b_delay_high.loadFromFile(finder.resource_path + "/audio/sfx/deep/delay_high.wav");
-	b_laser.loadFromFile(finder.resource_path + "/audio/sfx/laser1.wav");
-	b_gun_charge.loadFromFile(finder.resource_path + "/audio/sfx/gun_charge.wav");
-	b_minigus_build.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_build.wav");
-	b_minigus_invincibility.loadFromFile(finder.resource_path + "/audio/sfx/minigus/mg_inv.wav");
-	b_soda.loadFromFile(finder.resource_path + "/audio/sfx/soda.wav");
-	b_breakable_hit.loadFromFile(finder.resource_path + "/audio/sfx/breakable_hit.wav");
-
-	b_enemy_hit_low.loadFromFile(finder.resource_path + "/audio/sfx/enemy/hit_low.wav");
-	b_enemy_hit_medium.loadFromFile(finder.resource_path + "/audio/sfx/enemy/hit_medium.wav");
-	b_enemy_hit_high.loadFromFile(finder.resource_path + "/audio/sfx/enemy/hit_high.wav");
-	b_enemy_hit_squeak.loadFromFile(finder.resource_path + "/audio/sfx/enemy/hit_squeak.wav");
-	b_enemy_hit_inv.loadFromFile(finder.resource_path + "/audio/sfx/enemy/hit_inv.wav");
-	b_wall_hit.loadFromFile(finder.resource_path + "/audio/sfx/wall_hit.wav");
-	b_thud.loadFromFile(finder.resource_path + "/audio/sfx/thud.wav");
-	b_small_crash.loadFromFile(finder.resource_path + "/audio/sfx/small_crash.wav");
-	b_heavy_move.loadFromFile(finder.resource_path + "/audio/sfx/heavy_move.wav");
-	hard_hit.setBuffer(b_enemy_hit_inv);
-	wall_hit.setBuffer(b_wall_hit);
-	thud.setBuffer(b_thud);
-	small_crash.setBuffer(b_small_crash);
-	heavy_move.setBuffer(b_heavy_move);
-
-	save_buffer.loadFromFile(finder.resource_path + "/audio/sfx/save_point.wav");
-	save.setBuffer(save_buffer);
-	load_buffer.loadFromFile(finder.resource_path + "/audio/sfx/load_game.wav");
-	load.setBuffer(load_buffer);
-	soft_sparkle_high_buffer.loadFromFile(finder.resource_path + "/audio/sfx/soft_sparkle_high.wav");
-	soft_sparkle_high.setBuffer(soft_sparkle_high_buffer);
-	soft_sparkle_buffer.loadFromFile(finder.resource_path + "/audio/sfx/soft_sparkle.wav");
-	soft_sparkle.setBuffer(soft_sparkle_buffer);
-	chest_buffer.loadFromFile(finder.resource_path + "/audio/sfx/chest.wav");
-	b_switch_press.loadFromFile(finder.resource_path + "/audio/sfx/switch_press.wav");
-	b_block_toggle.loadFromFile(finder.resource_path + "/audio/sfx/block_toggle.wav");
-	chest.setBuffer(chest_buffer);
-	breakable_hit.setBuffer(b_breakable_hit);
-	breakable_shatter.setBuffer(shatter_buffer);
-	switch_press.setBuffer(b_switch_press);
-	block_toggle.setBuffer(b_block_toggle);
+	npc_sounds.insert_or_assign("mirin", vs_mirin);
 }
 
+void AssetManager::queue(sf::Texture& texture, std::string path) { pending_textures.push_back({&texture, std::move(path)}); }
+
+void AssetManager::queue(sf::SoundBuffer& buffer, std::string path) { pending_sounds.push_back({&buffer, std::move(path)}); }
+
 } // namespace data
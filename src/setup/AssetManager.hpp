@@ -4,8 +4,12 @@
 #include <SFML/Audio.hpp>
 #include <SFML/Graphics.hpp>
 #include <array>
+#include <cstddef>
 #include <filesystem>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "../graphics/FLColor.hpp"
 #include "../setup/EnumLookups.hpp"
@@ -24,8 +28,17 @@ class AssetManager {
 	AssetManager() = default;
 	~AssetManager() {}
 
+	// these only queue files. boot decodes the queue across the job system, then the uploads hand the results to
+	// their textures and buffers on the thread that owns the context.
 	void import_textures();
 	void load_audio();
+	// safe to call from any thread, once per index. returns the file's path under the resource folder.
+	auto decode_texture(std::size_t i) -> std::string_view;
+	auto decode_sound(std::size_t i) -> std::string_view;
+	void upload_textures();
+	void upload_sounds();
+	[[nodiscard]] auto queued_textures() const -> std::size_t { return pending_textures.size(); }
+	[[nodiscard]] auto queued_sounds() const -> std::size_t { return pending_sounds.size(); }
 
 	// player and NPCs!
 	sf::Texture t_nani{};
@@ -299,63 +312,67 @@ class AssetManager {
 	sf::SoundBuffer soft_sparkle_buffer{};
 	sf::SoundBuffer chest_buffer{};
 
-	sf::Sound landed{};
-	sf::Sound step{};
-	sf::Sound shatter{};
-	sf::Sound jump{};
-	sf::Sound arms_switch{};
-	sf::Sound bg_shot{};
-	sf::Sound plasmer_shot{};
-	sf::Sound skycorps_ar_shot{};
-	sf::Sound tomahawk_flight{};
-	sf::Sound tomahawk_catch{};
-	sf::Sound pop_mid{};
-	sf::Sound bubble{};
-	sf::Sound nova_shot{};
-	sf::Sound staple{};
-	sf::Sound gnat{};
-
-	sf::Sound hard_hit{};
-	sf::Sound thud{};
-	sf::Sound small_crash{};
-	sf::Sound heavy_move{};
-
-	sf::Sound minigun_neutral{};
-	sf::Sound minigun_charge{};
-	sf::Sound minigun_reload{};
-	sf::Sound minigun_firing{};
-	sf::Sound chest{};
-	sf::Sound save{};
-	sf::Sound load{};
-	sf::Sound soft_sparkle_high{};
-	sf::Sound soft_sparkle{};
-	sf::Sound click{};
-	sf::Sound tank_alert_1{};
-	sf::Sound tank_alert_2{};
-	sf::Sound tank_hurt_1{};
-	sf::Sound tank_hurt_2{};
-	sf::Sound tank_death{};
-	sf::Sound hurt{};
-	sf::Sound player_death{};
-	sf::Sound enem_hit{};
-	sf::Sound enem_death_1{};
-	sf::Sound heal{};
-	sf::Sound health_increase{};
-	sf::Sound orb_1{};
-	sf::Sound orb_2{};
-	sf::Sound orb_3{};
-	sf::Sound orb_4{};
-	sf::Sound menu_next{};
-	sf::Sound menu_back{};
-	sf::Sound sharp_click{};
-	sf::Sound menu_shift{};
-	sf::Sound menu_open{};
-
-	sf::Sound breakable_hit{};
-	sf::Sound breakable_shatter{};
-	sf::Sound switch_press{};
-	sf::Sound block_toggle{};
-	sf::Sound wall_hit{};
+	// sound sources open the audio device, so they only exist once load_audio has run. the headless runner never creates them.
+	struct Sounds {
+		sf::Sound landed{};
+		sf::Sound step{};
+		sf::Sound shatter{};
+		sf::Sound jump{};
+		sf::Sound arms_switch{};
+		sf::Sound bg_shot{};
+		sf::Sound plasmer_shot{};
+		sf::Sound skycorps_ar_shot{};
+		sf::Sound tomahawk_flight{};
+		sf::Sound tomahawk_catch{};
+		sf::Sound pop_mid{};
+		sf::Sound bubble{};
+		sf::Sound nova_shot{};
+		sf::Sound staple{};
+		sf::Sound gnat{};
+
+		sf::Sound hard_hit{};
+		sf::Sound thud{};
+		sf::Sound small_crash{};
+		sf::Sound heavy_move{};
+
+		sf::Sound minigun_neutral{};
+		sf::Sound minigun_charge{};
+		sf::Sound minigun_reload{};
+		sf::Sound minigun_firing{};
+		sf::Sound chest{};
+		sf::Sound save{};
+		sf::Sound load{};
+		sf::Sound soft_sparkle_high{};
+		sf::Sound soft_sparkle{};
+		sf::Sound click{};
+		sf::Sound tank_alert_1{};
+		sf::Sound tank_alert_2{};
+		sf::Sound tank_hurt_1{};
+		sf::Sound tank_hurt_2{};
+		sf::Sound tank_death{};
+		sf::Sound hurt{};
+		sf::Sound player_death{};
+		sf::Sound enem_hit{};
+		sf::Sound enem_death_1{};
+		sf::Sound heal{};
+		sf::Sound health_increase{};
+		sf::Sound orb_1{};
+		sf::Sound orb_2{};
+		sf::Sound orb_3{};
+		sf::Sound orb_4{};
+		sf::Sound menu_next{};
+		sf::Sound menu_back{};
+		sf::Sound sharp_click{};
+		sf::Sound menu_shift{};
+		sf::Sound menu_open{};
+
+		sf::Sound breakable_hit{};
+		sf::Sound breakable_shatter{};
+		sf::Sound switch_press{};
+		sf::Sound block_toggle{};
+		sf::Sound wall_hit{};
+	};
+	std::unique_ptr<Sounds> sounds{};
 
 	// other members
 	int music_vol{24};
@@ -373,6 +390,27 @@ class AssetManager {
 	std::unordered_map<std::string_view, sf::Texture&> projectile_textures{};
 	std::vector<sf::SoundBuffer> vs_mirin{};
 	std::unordered_map<std::string_view, std::vector<sf::SoundBuffer>> npc_sounds{};
+
+  private:
+	struct PendingTexture {
+		sf::Texture* texture{};
+		std::string path{};
+		sf::Image image{};
+		bool decoded{};
+	};
+	struct PendingSound {
+		sf::SoundBuffer* buffer{};
+		std::string path{};
+		std::vector<sf::Int16> samples{};
+		unsigned int channels{};
+		unsigned int sample_rate{};
+		bool decoded{};
+	};
+	void queue(sf::Texture& texture, std::string path);
+	void queue(sf::SoundBuffer& buffer, std::string path);
+
+	std::vector<PendingTexture> pending_textures{};
+	std::vector<PendingSound> pending_sounds{};
 };
 
 } // namespace asset
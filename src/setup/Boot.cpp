@@ -0,0 +1,55 @@
+#include "Boot.hpp"
+#include <span>
+#include <vector>
+
+namespace fornani {
+
+auto boot(automa::ServiceProvider& svc, bool assets) -> util::BootReport {
+	using Clk = util::BootReport::Clk;
+	auto ret = util::BootReport{};
+	ret.threads = svc.jobs.size();
+	if (assets) {
+		svc.assets.import_textures();
+		svc.assets.load_audio();
+	}
+	auto const num_textures = svc.assets.queued_textures();
+	auto const num_sounds = svc.assets.queued_sounds();
+
+	// the json jobs come first, so the longest single jobs start before the pool fills with images
+	enum : std::size_t { data_json, controls_json, text_json, num_json };
+	auto pieces = std::vector<util::BootReport::Piece>(num_json + num_textures + num_sounds);
+	svc.jobs.parallel_for(
+		pieces.size(),
+		[&](std::size_t i) {
+			auto& piece = pieces[i];
+			piece.start = Clk::now();
+			if (i == data_json) {
+				svc.data.load_data();
+			} else if (i == controls_json) {
+				svc.data.load_controls(svc.controller_map);
+			} else if (i == text_json) {
+				svc.text.load_data();
+			} else if (i < num_json + num_textures) {
+				piece.label = svc.assets.decode_texture(i - num_json);
+			} else {
+				piece.label = svc.assets.decode_sound(i - num_json - num_textures);
+			}
+			piece.finish = Clk::now();
+		},
+		1);
+
+	auto const all = std::span<util::BootReport::Piece const>{pieces};
+	ret.add("data json", pieces[data_json].start, pieces[data_json].finish);
+	ret.add("controls json", pieces[controls_json].start, pieces[controls_json].finish);
+	ret.add("text json", pieces[text_json].start, pieces[text_json].finish);
+	ret.add("image decode", all.subspan(num_json, num_textures));
+	ret.add("audio decode", all.subspan(num_json + num_textures));
+	if (assets) {
+		ret.measure("texture upload", [&svc] { svc.assets.upload_textures(); });
+		ret.measure("sound upload", [&svc] { svc.assets.upload_sounds(); });
+		ret.measure("glyph warmup", [&svc] { svc.text.warm_glyphs(); });
+	}
+	return ret;
+}
+
+} // namespace fornani
@@ -0,0 +1,12 @@
+#pragma once
+#include "../service/ServiceProvider.hpp"
+#include "../utils/BootReport.hpp"
+
+namespace fornani {
+
+// loads everything the game needs before its first state. json parsing and image and audio decoding are independent,
+// so they all fan out over svc.jobs. only texture and sound buffer uploads and glyph pages run on the calling thread, which must own the context.
+// the finders must already point at the resource folder. without assets nothing is queued, for headless runs.
+auto boot(automa::ServiceProvider& svc, bool assets = true) -> util::BootReport;
+
+} // namespace fornani
@@ -100,4 +100,27 @@ void ControllerMap::switch_to_joystick() { type = ControllerType::gamepad; }
 
 void ControllerMap::switch_to_keyboard() { type = ControllerType::keyboard; }
 
+auto ControllerMap::capture() const -> InputFrame {
+	auto ret = InputFrame{};
+	for (auto const& [label, control] : label_to_control) {
+		for (auto state : {ActionState::held, ActionState::released, ActionState::triggered}) {
+			if (control.state.test(state)) { ret.controls |= std::uint64_t{1} << (static_cast<int>(control.action) * 3 + static_cast<int>(state)); }
+		}
+	}
+	ret.throttle = throttle;
+	ret.gamepad = is_gamepad();
+	return ret;
+}
+
+void ControllerMap::restore(InputFrame const& frame) {
+	for (auto& [label, control] : label_to_control) {
+		control.state = {};
+		for (auto state : {ActionState::held, ActionState::released, ActionState::triggered}) {
+			if (frame.controls & (std::uint64_t{1} << (static_cast<int>(control.action) * 3 + static_cast<int>(state)))) { control.state.set(state); }
+		}
+	}
+	throttle = frame.throttle;
+	type = frame.gamepad ? ControllerType::gamepad : ControllerType::keyboard;
+}
+
 } // namespace config
\ No newline at end of file
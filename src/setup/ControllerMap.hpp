@@ -2,6 +2,7 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <string_view>
 #include <unordered_map>
 #include "../utils/BitFlags.hpp"
@@ -39,6 +40,14 @@ struct Control {
 	}
 };
 
+// the whole controller state at the start of a tick, packed for input recording and replay
+struct InputFrame {
+	std::uint64_t controls{}; // one bit per (action, state) pair
+	sf::Vector2<float> throttle{};
+	bool gamepad{};
+	bool operator==(InputFrame const&) const = default;
+};
+
 class ControllerMap {
   public:
 	ControllerMap(automa::ServiceProvider& svc);
@@ -49,6 +58,8 @@ class ControllerMap {
 	void reset_triggers();
 	void switch_to_joystick();
 	void switch_to_keyboard();
+	[[nodiscard]] auto capture() const -> InputFrame;
+	void restore(InputFrame const& frame);
 	[[nodiscard]] auto get_throttle() const -> sf::Vector2<float> { return throttle; }
 	[[nodiscard]] auto gamepad_connected() const -> bool { return status.test(ControllerStatus::gamepad_connected); }
 	[[nodiscard]] auto is_gamepad() const -> bool { return type == ControllerType::gamepad; }
@@ -14,43 +14,21 @@ void DataManager::load_data(std::string in_room) {
 	assert(!map_table.is_null());
 	for (auto const& room : map_table["rooms"].array_view()) { m_services->tables.get_map_label.insert(std::make_pair(room["room_id"].as<int>(), room["label"].as_string())); }
 
-	// load map
-	//std::cout << "loading map data...";
-	int room_counter{};
-	for (auto& room : rooms) {
-		map_jsons.push_back(MapData());
-		map_jsons.back().id = room;
-		std::string room_str = m_services->tables.get_map_label.contains(room) ? finder.resource_path + "/level/" + m_services->tables.get_map_label.at(room) : finder.resource_path + "/level/" + in_room;
-		map_jsons.back().metadata = dj::Json::from_file((room_str + "/meta.json").c_str());
-		assert(!map_jsons.back().metadata.is_null());
-		map_jsons.back().tiles = dj::Json::from_file((room_str + "/tile.json").c_str());
-		assert(!map_jsons.back().tiles.is_null());
-		map_jsons.back().inspectable_data = dj::Json::from_file((room_str + "/inspectables.json").c_str());
-		// cache map layers
-		int layer_counter{};
-		sf::Vector2<uint32_t> dimensions{};
-		dimensions.x = map_jsons.back().metadata["meta"]["dimensions"][0].as<int>();
-		dimensions.y = map_jsons.back().metadata["meta"]["dimensions"][1].as<int>();
-		map_layers.push_back(std::vector<world::Layer>());
-		for (int i = 0; i < num_layers; ++i) { map_layers.at(room_counter).push_back(world::Layer(i, (i == world::MIDDLEGROUND), dimensions)); }
-		for (auto& layer : map_layers.at(room_counter)) {
-			int cell_counter{};
-			layer.grid = world::Grid(dimensions);
-			for (auto& cell : map_jsons.back().tiles["layers"][layer_counter].array_view()) {
-				layer.grid.cells.at(cell_counter).value = cell.as<int>();
-				++cell_counter;
-			}
-			layer.grid.seed_vertices();
-			++layer_counter;
-		}
-		++room_counter;
+	// rooms are read on demand, from the compiled level pack when it is fresh and from their json otherwise
+	auto labels = m_services->tables.get_map_label;
+	for (auto const room : rooms) {
+		if (!labels.contains(room)) { labels.emplace(room, in_room); }
 	}
+	room_cache.open(finder.resource_path + "/level", std::move(labels));
 
+	// a save still being written would race the recovery below, and the files are read back from disk
+	saves.flush();
 	auto ctr{0};
 	for (auto& file : files) {
 		file.id = ctr;
 		file.label = "file_" + std::to_string(ctr);
-		file.save_data = dj::Json::from_file((finder.resource_path + "/data/save/file_" + std::to_string(ctr) + ".json").c_str());
+		SaveWriter::recover(get_save_path(ctr));
+		file.save_data = dj::Json::from_file(get_save_path(ctr).string().c_str());
 		if ((dj::Boolean)file.save_data["status"]["new"].as_bool()) { file.flags.set(fornani::FileFlags::new_file); }
 		++ctr;
 	}
@@ -91,7 +69,7 @@ void DataManager::load_data(std::string in_room) {
 	//std::cout << " success!\n";
 }
 
-void DataManager::save_progress(player::Player& player, int save_point_id) {
+void DataManager::save_progress(player::Player& player, int save_point_id, SaveWriter::Callback on_saved) {
 
 	auto& save = files.at(current_save).save_data;
 	files.at(current_save).write();
@@ -179,7 +157,7 @@ void DataManager::save_progress(player::Player& player, int save_point_id) {
 	out_stat["seconds_played"] = m_services->ticker.in_game_seconds_passed.count();
 	out_stat["time_trials"]["bryns_gun"] = s.time_trials.bryns_gun;
 
-	save.dj::Json::to_file((finder.resource_path + "/data/save/file_" + std::to_string(current_save) + ".json").c_str());
+	saves.write(get_save_path(current_save), save, std::move(on_saved));
 }
 
 int DataManager::load_progress(player::Player& player, int const file, bool state_switch, bool from_menu) {
@@ -273,12 +251,34 @@ int DataManager::load_progress(player::Player& player, int const file, bool stat
 	return room_id;
 }
 
+void DataManager::write_progress(util::ByteBuffer& out) const {
+	out.write(discovered_rooms);
+	out.write(unlocked_doors);
+	out.write(opened_chests);
+	out.write(activated_switches);
+	out.write(destroyed_blocks);
+	out.write(destroyed_inspectables);
+	out.write(quest_progressions);
+}
+
+void DataManager::read_progress(util::ByteBuffer& in) {
+	in.read(discovered_rooms);
+	in.read(unlocked_doors);
+	in.read(opened_chests);
+	in.read(activated_switches);
+	in.read(destroyed_blocks);
+	in.read(destroyed_inspectables);
+	in.read(quest_progressions);
+	m_services->quest = {};
+	for (auto const& key : quest_progressions) { m_services->quest.process(key); }
+}
+
 void DataManager::write_death_count(player::Player& player) {
 	auto& save = files.at(current_save).save_data;
 	auto& out_stat = save["player_data"]["stats"];
 	auto const& s = m_services->stats;
 	out_stat["death_count"] = s.player.death_count.get_count();
-	save.dj::Json::to_file((finder.resource_path + "/data/save/file_" + std::to_string(current_save) + ".json").c_str());
+	saves.write(get_save_path(current_save), save);
 }
 
 std::string_view DataManager::load_blank_save(player::Player& player, bool state_switch) {
@@ -442,15 +442,10 @@ void DataManager::save_controls(config::ControllerMap& controller) { controls.dj
 
 void DataManager::reset_controls() { controls = dj::Json::from_file((finder.resource_path + "/data/config/defaults.json").c_str()); }
 
-int DataManager::get_room_index(int id) {
-	auto ctr{0};
-	for (auto& room : rooms) {
-		if (room == id) { return ctr; }
-		++ctr;
-	}
-	return ctr;
+// the loaded room is always resident, so this is a plain lookup that workers can share. only a miss touches the cache.
+std::vector<world::Layer>& DataManager::get_layers(int id) {
+	if (auto* room = room_cache.find(id)) { return room->layers; }
+	return room_cache.get(id).layers;
 }
 
-std::vector<world::Layer>& DataManager::get_layers(int id) { return map_layers.at(get_room_index(id)); }
-
 } // namespace data
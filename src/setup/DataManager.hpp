@@ -10,7 +10,10 @@
 #include <array>
 #include "ResourceFinder.hpp"
 #include "File.hpp"
+#include "RoomCache.hpp"
+#include "SaveWriter.hpp"
 #include "../utils/QuestCode.hpp"
+#include "../utils/ByteBuffer.hpp"
 #include "../level/Map.hpp"
 
 namespace automa {
@@ -27,23 +30,20 @@ class Player;
 
 namespace data {
 
-	struct MapData {
-	int id{};
-	dj::Json metadata{};
-	dj::Json tiles{};
-	dj::Json inspectable_data{};
-	};
-
 class DataManager {
 
 	public:
 	DataManager(automa::ServiceProvider& svc);
 	// game save
 	void load_data(std::string in_room = "");
-	void save_progress(player::Player& player, int save_point_id);
+	// the file is written in the background. on_saved runs from saves.poll() once it is on disk, or failed to get there.
+	void save_progress(player::Player& player, int save_point_id, SaveWriter::Callback on_saved = {});
 	int load_progress(player::Player& player, int const file, bool state_switch = false, bool from_menu = true);
 	void write_death_count(player::Player& player);
 	std::string_view load_blank_save(player::Player& player, bool state_switch = false);
+	// binary copies of the progress lists for WorldSnapshot. reading also rebuilds the quest tracker.
+	void write_progress(util::ByteBuffer& out) const;
+	void read_progress(util::ByteBuffer& in);
 	dj::Json& get_save() { return files.at(current_save).save_data; }
 	fornani::File& get_file() { return files.at(current_save); }
 
@@ -77,7 +77,6 @@ class DataManager {
 		return false;
 	}
 
-	int get_room_index(int id);
 	std::vector<world::Layer>& get_layers(int id);
 
 	dj::Json game_info{};
@@ -106,9 +105,8 @@ class DataManager {
 	dj::Json map_table{};
 	dj::Json background{};
 
-	std::vector<MapData> map_jsons{};
-	std::vector<std::vector<world::Layer>> map_layers{};
-	int num_layers{8};
+	RoomCache room_cache{};
+	SaveWriter saves{};
 	std::vector<int> rooms{0, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 199, 120, 121, 122, 123, 124, 200, 224, 299};
 	std::vector<int> discovered_rooms{};
 
@@ -117,6 +115,8 @@ class DataManager {
 	automa::ServiceProvider* m_services;
 
   private:
+	[[nodiscard]] auto get_save_path(int file) const -> std::filesystem::path { return finder.resource_path + "/data/save/file_" + std::to_string(file) + ".json"; }
+
 	std::vector<int> opened_chests{};
 	std::vector<int> unlocked_doors{};
 	std::vector<int> activated_switches{};
@@ -1,4 +1,5 @@
 #include "Game.hpp"
+#include "Boot.hpp"
 #include <ctime>
 
 namespace fornani {
@@ -8,7 +9,10 @@ Game::Game(char** argv) : player(services) {
 	services.data = data::DataManager(services);
 	services.data.finder.setResourcePath(argv);
 	services.data.finder.set_scene_path(argv);
-	services.data.load_data();
+	services.text.finder.setResourcePath(argv);
+	services.assets.finder.setResourcePath(argv);
+	services.music.finder.setResourcePath(argv);
+	auto const report = boot(services);
 	// metadata
 	auto const& in_info = services.data.game_info;
 	metadata.title = in_info["title"].as_string();
@@ -18,18 +22,9 @@ Game::Game(char** argv) : player(services) {
 	metadata.hotfix = in_info["version"]["hotfix"].as<int>();
 
 	std::cout << "> launching " << metadata.long_title() << "\n";
+	report.print(std::cout);
 
-	// controls
-	services.data.load_controls(services.controller_map);
-	// text
-	services.text.finder.setResourcePath(argv);
-	services.text.load_data();
-	// image
-	services.assets.finder.setResourcePath(argv);
-	services.assets.import_textures();
 	// sounds
-	services.music.finder.setResourcePath(argv);
-	services.assets.load_audio();
 	playtest.m_musicplayer = true;
 	services.music.turn_on();
 	// player
@@ -57,6 +52,10 @@ Game::Game(char** argv) : player(services) {
 	ImGui::SFML::Init(window);
 }
 
+Game::~Game() {
+	if (flags.test(GameFlags::recording)) { replay.save(replay_path); }
+}
+
 void Game::run(bool demo, int room_id, std::filesystem::path levelpath, sf::Vector2<float> player_position) {
 
 	// for editor demo. should be excluded for releases.
@@ -66,6 +65,8 @@ void Game::run(bool demo, int room_id, std::filesystem::path levelpath, sf::Vect
 		game_state.get_current_state().target_folder.paths.scene = levelpath;
 		services.music.turn_off();
 		services.data.load_blank_save(player);
+		auto const seed = std::random_device{}();
+		services.random.seed(seed);
 		game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 		//TODO: fix this
 		game_state.get_current_state().init(services, room_id, levelpath.filename().string());
@@ -73,6 +74,10 @@ void Game::run(bool demo, int room_id, std::filesystem::path levelpath, sf::Vect
 		//
 		services.state_controller.player_position = player_position;
 		player.set_position(player_position);
+		if (!replay_path.empty()) {
+			replay.start_recording(seed, room_id, player_position);
+			flags.set(GameFlags::recording);
+		}
 	} else {
 		game_state.get_current_state().target_folder.paths.scene = services.data.finder.scene_path;
 		game_state.get_current_state().target_folder.paths.region = services.data.finder.scene_path + "/firstwind";
@@ -137,7 +142,7 @@ void Game::run(bool demo, int room_id, std::filesystem::path levelpath, sf::Vect
 				if (event.key.code == sf::Keyboard::Unknown) { valid_event = false; }
 				if (event.key.code == sf::Keyboard::D) {
 					//debug() ? services.debug_flags.reset(automa::DebugFlags::imgui_overlay) : services.debug_flags.set(automa::DebugFlags::imgui_overlay);
-					//services.assets.sharp_click.play();
+					//services.assets.sounds->sharp_click.play();
 					//services.state_controller.actions.set(automa::Actions::print_stats);
 				}
 				if (event.key.code == sf::Keyboard::Q) {
@@ -147,10 +152,10 @@ void Game::run(bool demo, int room_id, std::filesystem::path levelpath, sf::Vect
 				if (event.key.code == sf::Keyboard::P) {
 					/*if (flags.test(GameFlags::playtest)) {
 						flags.reset(GameFlags::playtest);
-						services.assets.menu_back.play();
+						services.assets.sounds->menu_back.play();
 					} else {
 						flags.set(GameFlags::playtest);
-						services.assets.menu_next.play();
+						services.assets.sounds->menu_next.play();
 					}*/
 				}
 				if (event.key.code == sf::Keyboard::F12) { take_screenshot(); }
@@ -174,31 +179,50 @@ void Game::run(bool demo, int room_id, std::filesystem::path levelpath, sf::Vect
 
 		// game logic and rendering
 		services.music.update();
-		services.ticker.tick([this, &services = services] { game_state.get_current_state().tick_update(services); });
+		services.data.saves.poll(); // save writes that finished since last frame report back here
+		services.ticker.tick([this, &services = services] {
+			if (flags.test(GameFlags::recording)) { replay.record(services.controller_map); }
+			game_state.get_current_state().tick_update(services);
+		});
 		game_state.get_current_state().frame_update(services);
+		// the outgoing state owns textures the render thread may still be drawing
+		if (state_change_pending()) { renderer.flush(); }
 		game_state.process_state(services, player, *this);
 		if (services.state_controller.actions.consume(automa::Actions::screenshot)) { take_screenshot(); }
 
+		// imgui draws straight to the window, so frames with an overlay are presented on this thread
+		auto const threaded = !debug() && !flags.test(GameFlags::playtest);
+		threaded ? renderer.start() : renderer.stop();
+
 		ImGui::SFML::Update(window, deltaClock.restart());
-		screencap.update(window);
+		if (!threaded) { screencap.update(window); }
 
 		// ImGui stuff
 		if (services.debug_flags.test(automa::DebugFlags::imgui_overlay)) { debug_window(); }
 		if (flags.test(GameFlags::playtest)) { playtester_portal(); }
 
 		// my renders
-		window.clear();
-		window.draw(background);
-
-		game_state.get_current_state().render(services, window);
-
-		ImGui::SFML::Render(window);
-		window.display();
+		auto& list = threaded ? renderer.get_list() : frame;
+		list.draw(background);
+
+		game_state.get_current_state().render(services, list);
+
+		if (threaded) {
+			ImGui::EndFrame();
+			renderer.submit();
+		} else {
+			window.clear();
+			frame.replay(window);
+			frame.clear();
+			ImGui::SFML::Render(window);
+			window.display();
+		}
 
 		services.ticker.end_frame();
 	}
 
 	//shutdown
+	renderer.stop();
 	//explicitly delete music player since it can't be deleted after AssetManager
 	services.music.stop();
 	ImGui::SFML::Shutdown();
@@ -265,6 +289,26 @@ void Game::debug_window() {
 						services.ticker.tick_multiplier = 16;
 					}
 					ImGui::Separator();
+					ImGui::Text("Tick Budget");
+					auto& budget = services.ticker.budget;
+					if (ImGui::RadioButton("Slow Down", budget.policy == util::TickPolicy::slowdown)) { budget.policy = util::TickPolicy::slowdown; }
+					ImGui::SameLine();
+					if (ImGui::RadioButton("Catch Up", budget.policy == util::TickPolicy::catch_up)) { budget.policy = util::TickPolicy::catch_up; }
+					ImGui::SliderInt("Max Ticks Per Frame", &budget.max_ticks, 1, 32);
+					ImGui::SliderFloat("Max Debt (ticks)", &budget.max_debt, 0.f, 64.f, "%.0f");
+					ImGui::Text("Tick Cost: %.3fms (max %.3fms)", budget.tick_cost, budget.max_tick_cost);
+					ImGui::PlotLines("##tick_costs", [](void* data, int index) { return static_cast<util::RingBuffer<float, 256>*>(data)->at(index); }, &services.ticker.tick_costs, static_cast<int>(services.ticker.tick_costs.size()), 0, "tick cost (ms)", 0.f, FLT_MAX, ImVec2(0, 60));
+					ImGui::Text("Debt: %.0f ticks", budget.debt);
+					ImGui::Text("Dropped Ticks: %.0f", budget.dropped_ticks);
+					ImGui::Text("Capped Frames: %i", budget.capped_frames);
+					ImGui::Text("Skipped Frames: %i", budget.skipped_frames);
+					if (ImGui::Button("Reset Counters")) {
+						budget.max_tick_cost = {};
+						budget.dropped_ticks = {};
+						budget.capped_frames = {};
+						budget.skipped_frames = {};
+					}
+					ImGui::Separator();
 					ImGui::Text("Stopwatch");
 					ImGui::Text("average time: %.4f", services.stopwatch.get_snapshot());
 
@@ -291,7 +335,7 @@ void Game::debug_window() {
 					ImGui::Text("Player Restricted? : %s", player.controller.restricted() ? "Yes" : "No");
 					ImGui::Text("Player Inspecting? : %s", player.controller.inspecting() ? "Yes" : "No");
 					ImGui::Separator();
-					ImGui::SliderInt("Text Size", &game_state.get_current_state().console.writer.text_size, 6, 64);
+					if (ImGui::SliderInt("Text Size", &game_state.get_current_state().console.writer.text_size, 6, 64)) { services.text.warm_glyphs(static_cast<unsigned>(game_state.get_current_state().console.writer.text_size)); }
 
 					ImGui::EndTabItem();
 				}
@@ -356,6 +400,7 @@ void Game::debug_window() {
 							ImGui::Text("Player Vel: (%.4f,%.4f)", player.collider.physics.velocity.x, player.collider.physics.velocity.y);
 							ImGui::Text("Player Acc: (%.4f,%.4f)", player.collider.physics.acceleration.x, player.collider.physics.acceleration.y);
 							ImGui::Text("Player Jer: (%.4f,%.4f)", player.collider.physics.jerk.x, player.collider.physics.jerk.y);
+							ImGui::Text("Player Max Acc: (%.4f,%.4f)", player.collider.physics.maximum_acceleration.x, player.collider.physics.maximum_acceleration.y);
 							ImGui::Separator();
 							ImGui::Text("Player Grounded: %s", player.grounded() ? "Yes" : "No");
 							ImGui::Separator();
@@ -584,6 +629,13 @@ void Game::debug_window() {
 					ImGui::Text("Size of TextureUpdater (Bytes): %lu", sizeof(player.texture_updater));
 					ImGui::Text("Size of Collider (Bytes): %lu", sizeof(player.collider));
 					ImGui::Text("Size of Arsenal (Bytes): %lu", sizeof(player.arsenal));
+					ImGui::Separator();
+					ImGui::Text("Save Point Snapshot: room %i, %lu bytes", services.snapshots.save_point.get_room(), services.snapshots.save_point.size());
+					ImGui::Text("Room Entry Snapshot: room %i, %lu bytes", services.snapshots.room_entry.get_room(), services.snapshots.room_entry.size());
+					if (ImGui::Button("Rewind to Room Entry") && !services.snapshots.room_entry.empty()) {
+						services.snapshots.room_entry.restore(services, player);
+						game_state.get_current_state().restore(services, services.snapshots.room_entry.get_room());
+					}
 					ImGui::EndTabItem();
 				}
 				if (ImGui::BeginTabItem("State")) {
@@ -592,170 +644,170 @@ void Game::debug_window() {
 					ImGui::Text("Current State: ");
 					ImGui::SameLine();
 					/*if (ImGui::Button("Under")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/UNDER_LEDGE_01");
 						player.set_position({player::PLAYER_START_X, player::PLAYER_START_Y});
 					}
 					if (ImGui::Button("Minigus")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/FIRSTWIND_DECK_01");
 						player.set_position({32 * 4, 32 * 8});
 					}
 					if (ImGui::Button("Corridor 4")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/FIRSTWIND_CORRIDOR_04");
 						player.set_position({player::PLAYER_START_X * 2.f, player::PLAYER_START_Y * 2.f});
 					}
 					if (ImGui::Button("1x1 TEST")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/1x1_TEST");
 						player.set_position({player::PLAYER_START_X * 2.f + 128, player::PLAYER_START_Y * 2.f});
 					}
 					if (ImGui::Button("House")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/UNDER_HUT_01");
 
 						player.set_position({100, 160});
 					}
 					if (ImGui::Button("Night Plat")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/NIGHT_PLATFORMS_01");
 
 						player.set_position({100, 160});
 					}
 					if (ImGui::Button("Base")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/BASE_LIVING_01");
 
 						player.set_position({25 * 32, 10 * 32});
 					}
 					if (ImGui::Button("Mayhem")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/NIGHT_MAYHEM_01");
 
 						player.set_position({28 * 32, 8 * 32});
 					}
 					if (ImGui::Button("Abandoned Course")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/ABANDONED_COURSE_01");
 
 						player.set_position({15 * 32 * 4, 8 * 32});
 					}
 					if (ImGui::Button("Abandoned Passage")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/ABANDONED_PASSAGE_01");
 
 						player.set_position({16 * 32 * 6, 8 * 32});
 					}
 					if (ImGui::Button("Breakable Test")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/BREAKABLE_TEST_01");
 
 						player.set_position({20 * 32, 8 * 32});
 					}
 					if (ImGui::Button("Skycorps")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/SKYCORPS_YARD_01");
 
 						player.set_position({28 * 32, 8 * 32});
 					}
 					if (ImGui::Button("Sky")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/SKY_CHAMBER_01");
 						player.set_position({7 * 32, 16 * 32});
 					}
 
 					if (ImGui::Button("Corridor 2")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/FIRSTWIND_CORRIDOR_02");
 						player.set_position({7 * 32, 7 * 32});
 					}
 					if (ImGui::Button("Shadow")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/SHADOW_DOJO_01");
 						player.set_position({4 * 32, 11 * 32});
 					}
 					if (ImGui::Button("Stone")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/STONE_CORRIDOR_01");
 						player.set_position({10 * 32, 16 * 32});
 					}
 					if (ImGui::Button("Overturned")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/OVERTURNED_DOJO_01");
 						player.set_position({4 * 32, 11 * 32});
 					}
 					if (ImGui::Button("Glade")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/OVERTURNED_GLADE_01");
 						player.set_position({8 * 32, 8 * 32});
 					}
 					if (ImGui::Button("Woodshine")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/WOODSHINE_VILLAGE_01");
 						player.set_position({32, 1280});
 					}
 					if (ImGui::Button("Collision Room")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/SKY_COLLISIONROOM_01");
 						player.set_position({5 * 32, 5 * 32});
 					}
 					if (ImGui::Button("Grub Dojo")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/GRUB_DOJO_01");
 						player.set_position({3 * 32, 8 * 32});
 					}
 					if (ImGui::Button("Firstwind Dojo")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/BASE_TEST_03");
 						player.set_position({3 * 32, 8 * 32});
 					}*/
 					/*if (ImGui::Button("Atrium")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, services.assets.resource_path + "/level/FIRSTWIND_ATRIUM_01");
 					}
 					if (ImGui::Button("Hangar")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, services.assets.resource_path + "/level/FIRSTWIND_HANGAR_01");
 						player.set_position({ 3080, 790 });
 					}
 					if (ImGui::Button("Corridor 3")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, services.assets.resource_path + "/level/FIRSTWIND_CORRIDOR_03");
 						player.set_position({ 2327, 360 });
 					}
 					if(ImGui::Button("Lab")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, services.assets.resource_path + "/level/TOXIC_LAB_01");
 					}*/
 					/*if (ImGui::Button("Toxic")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/TOXIC_ARENA_01");
 						player.set_position({player::PLAYER_START_X, player::PLAYER_START_Y});
@@ -763,20 +815,20 @@ void Game::debug_window() {
 						player.set_position({34, 484});
 					}
 					if (ImGui::Button("Grub")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/GRUB_TUNNEL_01");
 						player.set_position({224, 290});
 					}*/
 					/*if(ImGui::Button("Night")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, services.assets.resource_path + "/level/NIGHT_CRANE_01");
 						player.set_position({50, 50});
 						player.assign_texture(services.assets.t_nani_dark);
 					}*/
 					/*if (ImGui::Button("Night 2")) {
-						services.assets.click.play();
+						services.assets.sounds->click.play();
 						game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 						game_state.get_current_state().init(services, "/level/NIGHT_CATWALK_01");
 						player.set_position({50, 50});
@@ -925,61 +977,61 @@ void Game::playtester_portal() {
 							flags.reset(GameFlags::in_game);
 						}
 						if (ImGui::Button("Minigus")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 115);
 							player.set_position({32 * 3, 32 * 8});
 						}
 						if (ImGui::Button("Hangar")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 112);
 							player.set_position({32 * 2, 32 * 8});
 						}
 						if (ImGui::Button("Shaft")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 107);
 							player.set_position({32 * 6, 32 * 4});
 						}
 						if (ImGui::Button("Atrium 1")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 102);
 							player.set_position({32 * 45, 32 * 56});
 						}
 						if (ImGui::Button("Corridor 2")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 104);
 							player.set_position({7 * 32, 7 * 32});
 						}
 						if (ImGui::Button("Arena")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 121);
 							player.set_position({3 * 32, 9 * 32});
 						}
 						if (ImGui::Button("Bunker")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 124);
 							player.set_position({4 * 32, 3 * 32});
 						}
 						if (ImGui::Button("Cargo")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 103);
 							player.set_position({7 * 32, 7 * 32});
 						}
 						if (ImGui::Button("Prison")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 100);
 							player.set_position({7 * 32, 7 * 32});
 						}
 						if (ImGui::Button("Lab")) {
-							services.assets.click.play();
+							services.assets.sounds->click.play();
 							game_state.set_current_state(std::make_unique<automa::Dojo>(services, player, "dojo"));
 							game_state.get_current_state().init(services, 110);
 							player.set_position({7 * 32, 9 * 32});
@@ -1088,11 +1140,20 @@ void Game::take_screenshot() {
 
 	std::erase_if(time_str, [](auto const& c) { return c == ':' || isspace(c); });
 	std::string filename = "screenshot_" + time_str + ".png";
+	if (renderer.running()) {
+		renderer.capture(filename);
+		return;
+	}
 	if (screencap.copyToImage().saveToFile(filename)) { std::cout << "screenshot saved to " << filename << std::endl; }
 }
 
 bool Game::debug() { return services.debug_flags.test(automa::DebugFlags::imgui_overlay); }
 
+bool Game::state_change_pending() {
+	auto const& actions = services.state_controller.actions;
+	return actions.test(automa::Actions::trigger) || actions.test(automa::Actions::trigger_submenu) || actions.test(automa::Actions::exit_submenu) || actions.test(automa::Actions::player_death);
+}
+
 void Game::playtest_sync() {
 	if (!player.arsenal) {
 		playtest.weapons = {};
@@ -7,19 +7,22 @@
 #include "../audio/MusicPlayer.hpp"
 #include "../utils/BitFlags.hpp"
 #include "../setup/Version.hpp"
+#include "../setup/InputReplay.hpp"
+#include "../graphics/Renderer.hpp"
 #include <imgui-SFML.h>
 #include <filesystem>
 
 namespace fornani {
 
-enum class GameFlags { playtest, in_game };
+enum class GameFlags { playtest, in_game, recording };
 
 class Game {
   public:
 	Game() = default;
 	Game(char** argv);
-	~Game() {}
+	~Game();
 	void run(bool demo = false, int room_id = 100, std::filesystem::path levelpath = std::filesystem::path{}, sf::Vector2<float> player_position = {});
+	void record_input(std::filesystem::path path) { replay_path = std::move(path); } // demo runs only; written on exit
 
 	void playtest_sync();
 	void toggle_weapon(bool flag, int id);
@@ -31,6 +34,7 @@ class Game {
 	void playtester_portal();
 	void take_screenshot();
 	bool debug();
+	bool state_change_pending();
 	automa::ServiceProvider services{};
 
 	struct {
@@ -64,10 +68,15 @@ class Game {
 	player::Player player;
 	automa::StateManager game_state{};
 	sf::RenderWindow window{};
+	flfx::Renderer renderer{window};
+	flfx::DrawList frame{}; // recorded and replayed on the main thread while imgui is up
 	sf::Texture screencap{};
 	sf::RectangleShape background{};
 
 	Version metadata{};
+
+	config::InputReplay replay{};
+	std::filesystem::path replay_path{};
 };
 
 } // namespace fornani
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "Headless.hpp"
+#include "Boot.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+namespace fornani {
+
+Headless::Headless(char** argv) : player(services) {
+	services.debug_flags.set(automa::DebugFlags::headless);
+	// data
+	services.data = data::DataManager(services);
+	services.data.finder.setResourcePath(argv);
+	services.data.finder.set_scene_path(argv);
+	services.text.finder.setResourcePath(argv);
+	services.assets.finder.setResourcePath(argv);
+	services.music.finder.setResourcePath(argv);
+	// no textures or sounds are imported, and music stays off
+	boot(services, false).print(std::cout);
+	services.music.turn_off();
+	services.soundboard.turn_off();
+	// player
+	player.init(services);
+}
+
+void Headless::run(int room_id, int num_ticks) {
+	std::cout << "> headless: room " << room_id << ", " << num_ticks << " ticks\n";
+	services.random.seed(seed);
+	load_room(room_id);
+	simulate(num_ticks);
+}
+
+void Headless::replay(std::filesystem::path const& path) {
+	auto input = config::InputReplay{};
+	if (!input.load(path)) { return; }
+	std::cout << "> headless: replaying " << path.string() << " in room " << input.get_room() << ", " << input.get_length() << " ticks\n";
+	services.random.seed(input.get_seed());
+	load_room(input.get_room());
+	services.state_controller.player_position = input.get_start_position();
+	player.set_position(input.get_start_position());
+	simulate(static_cast<int>(input.get_length()), &input);
+}
+
+// runs the same scripted input at the shipped tick rate and at 60 Hz and reports how far the player's paths drift apart.
+// the script holds right and sprint, so the player runs across the room at top speed, where tunneling and seam stutter show up.
+void Headless::compare(int room_id, float seconds) {
+	std::cout << "> headless: comparing tick rates in room " << room_id << " over " << seconds << "s\n";
+	auto const shipped = services.ticker.tick_rate;
+	auto const fine = trace(room_id, seconds, shipped);
+	auto const coarse = trace(room_id, seconds, 1.f / 60.f);
+	services.ticker.tick_rate = shipped;
+	auto const samples = std::min(fine.size(), coarse.size());
+	if (samples == 0) { return; }
+	auto max_deviation{0.f};
+	auto total_deviation{0.f};
+	for (auto i{0u}; i < samples; ++i) {
+		auto const delta = fine.at(i) - coarse.at(i);
+		auto const deviation = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+		max_deviation = std::max(max_deviation, deviation);
+		total_deviation += deviation;
+	}
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "> " << samples << " samples, end at (" << fine.back().x << ", " << fine.back().y << ") vs (" << coarse.back().x << ", " << coarse.back().y << ")\n";
+	std::cout << "> deviation (px): mean " << total_deviation / static_cast<float>(samples) << ", max " << max_deviation << "\n";
+}
+
+// samples the player's position every sample_interval seconds of simulated time, which both compared rates divide evenly.
+auto Headless::trace(int room_id, float seconds, float tick_rate) -> std::vector<sf::Vector2<float>> {
+	static constexpr auto sample_interval{0.05f};
+	services.ticker.tick_rate = tick_rate;
+	services.random.seed(seed);
+	load_room(room_id);
+	player.collider.physics.zero(); // don't carry the previous run's velocity in
+	auto script = config::InputFrame{};
+	for (auto action : {config::Action::right, config::Action::sprint}) { script.controls |= std::uint64_t{1} << (static_cast<int>(action) * 3 + static_cast<int>(config::ActionState::held)); }
+	auto const ticks_per_sample = std::max(static_cast<int>(std::round(sample_interval / tick_rate)), 1);
+	auto ret = std::vector<sf::Vector2<float>>{};
+	for (auto i{0}; i < static_cast<int>(seconds / sample_interval); ++i) {
+		for (auto j{0}; j < ticks_per_sample; ++j) {
+			services.ticker.step([this, &script] {
+				services.controller_map.restore(script);
+				dojo->tick_update(services);
+			});
+		}
+		ret.push_back(player.collider.physics.position);
+	}
+	return ret;
+}
+
+void Headless::load_room(int room_id) {
+	services.data.load_blank_save(player);
+	dojo = std::make_unique<automa::Dojo>(services, player, "dojo");
+	dojo->init(services, room_id);
+}
+
+void Headless::simulate(int num_ticks, config::InputReplay* input) {
+	using Clk = std::chrono::steady_clock;
+	tick_times.clear();
+	tick_times.reserve(static_cast<std::size_t>(std::max(num_ticks, 0)));
+	auto const start = Clk::now();
+	for (auto i{0}; i < num_ticks; ++i) {
+		auto const tick_start = Clk::now();
+		services.ticker.step([this, input] {
+			if (input) { input->play(services.controller_map); }
+			dojo->tick_update(services);
+		});
+		tick_times.push_back(std::chrono::duration<float, std::micro>(Clk::now() - tick_start).count());
+		services.data.saves.poll();
+	}
+	total_seconds = std::chrono::duration<float>(Clk::now() - start).count();
+	report();
+}
+
+void Headless::report() const {
+	if (tick_times.empty()) { return; }
+	auto sorted = tick_times;
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&sorted](float p) { return sorted.at(static_cast<std::size_t>(p * static_cast<float>(sorted.size() - 1))); };
+	auto const mean = std::accumulate(sorted.begin(), sorted.end(), 0.f) / static_cast<float>(sorted.size());
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "> " << sorted.size() << " ticks in " << total_seconds << "s (" << static_cast<float>(sorted.size()) / total_seconds << " ticks/s)\n";
+	std::cout << "> tick cost (us): min " << sorted.front() << ", mean " << mean << ", p50 " << percentile(0.5f) << ", p90 " << percentile(0.9f) << ", p99 " << percentile(0.99f) << ", max " << sorted.back() << "\n";
+	services.data.room_cache.print_memory(std::cout);
+}
+
+} // namespace fornani
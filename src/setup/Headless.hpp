@@ -0,0 +1,36 @@
+#pragma once
+#include "../automa/states/Dojo.hpp"
+#include "../service/ServiceProvider.hpp"
+#include "../entities/player/Player.hpp"
+#include "InputReplay.hpp"
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace fornani {
+
+// runs the simulation without a window, textures or audio. loads the same data as Game,
+// then ticks a Dojo as fast as possible and reports how long each tick took.
+class Headless {
+  public:
+	Headless(char** argv);
+	void run(int room_id = 100, int num_ticks = 10000);
+	void replay(std::filesystem::path const& path);
+	void compare(int room_id = 100, float seconds = 10.f);
+
+	std::uint32_t seed{1}; // fixed so repeated runs simulate identically
+
+  private:
+	void load_room(int room_id);
+	void simulate(int num_ticks, config::InputReplay* input = nullptr);
+	void report() const;
+	[[nodiscard]] auto trace(int room_id, float seconds, float tick_rate) -> std::vector<sf::Vector2<float>>;
+
+	automa::ServiceProvider services{};
+	player::Player player;
+	std::unique_ptr<automa::Dojo> dojo{};
+	std::vector<float> tick_times{}; // microseconds
+	float total_seconds{};
+};
+
+} // namespace fornani
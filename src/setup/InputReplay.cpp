@@ -0,0 +1,121 @@
+#include "InputReplay.hpp"
+#include <array>
+#include <fstream>
+#include <iostream>
+
+namespace config {
+
+namespace {
+
+constexpr std::array<char, 4> magic{'F', 'N', 'R', 'P'};
+constexpr std::uint16_t version{1};
+// tick, controls, throttle and the gamepad byte, as save() writes them
+constexpr std::size_t entry_size{sizeof(std::uint32_t) + sizeof(std::uint64_t) + 2 * sizeof(float) + sizeof(std::uint8_t)};
+
+template <typename T>
+void write(std::ofstream& out, T const& value) {
+	out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+void read(std::ifstream& in, T& value) {
+	in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+} // namespace
+
+void InputReplay::start_recording(std::uint32_t seed, int room, sf::Vector2<float> position) {
+	header = {seed, room, position, 0};
+	entries.clear();
+	rewind();
+}
+
+void InputReplay::record(ControllerMap const& controller) {
+	auto const frame = controller.capture();
+	if (entries.empty() || !(entries.back().frame == frame)) { entries.push_back({header.length, frame}); }
+	++header.length;
+}
+
+void InputReplay::play(ControllerMap& controller) {
+	if (finished()) {
+		// leave the controller idle once the recording runs out
+		controller.restore({});
+		return;
+	}
+	while (cursor < entries.size() && entries.at(cursor).tick <= tick) { ++cursor; }
+	// restore every tick, since the simulation itself clears triggers between ticks
+	controller.restore(cursor == 0 ? InputFrame{} : entries.at(cursor - 1).frame);
+	++tick;
+}
+
+bool InputReplay::save(std::filesystem::path const& path) const {
+	auto out = std::ofstream{path, std::ios::binary};
+	if (!out) {
+		std::cout << "> failed to write replay to " << path.string() << "\n";
+		return false;
+	}
+	write(out, magic);
+	write(out, version);
+	write(out, header.seed);
+	write(out, header.room);
+	write(out, header.position.x);
+	write(out, header.position.y);
+	write(out, header.length);
+	write(out, static_cast<std::uint32_t>(entries.size()));
+	for (auto const& entry : entries) {
+		write(out, entry.tick);
+		write(out, entry.frame.controls);
+		write(out, entry.frame.throttle.x);
+		write(out, entry.frame.throttle.y);
+		write(out, static_cast<std::uint8_t>(entry.frame.gamepad));
+	}
+	return static_cast<bool>(out);
+}
+
+bool InputReplay::load(std::filesystem::path const& path) {
+	auto in = std::ifstream{path, std::ios::binary};
+	auto in_magic = std::array<char, 4>{};
+	auto in_version = std::uint16_t{};
+	read(in, in_magic);
+	read(in, in_version);
+	if (!in || in_magic != magic || in_version != version) {
+		std::cout << "> " << path.string() << " is not a valid replay\n";
+		return false;
+	}
+	auto count = std::uint32_t{};
+	read(in, header.seed);
+	read(in, header.room);
+	read(in, header.position.x);
+	read(in, header.position.y);
+	read(in, header.length);
+	read(in, count);
+	entries.clear();
+	// the count comes from the file, so it is only trusted as far as the bytes after it can back it up
+	auto const position = in.tellg();
+	auto error = std::error_code{};
+	auto const size = std::filesystem::file_size(path, error);
+	if (!in || position < 0 || error || count > (size - static_cast<std::uintmax_t>(position)) / entry_size) {
+		std::cout << "> replay " << path.string() << " is truncated\n";
+		return false;
+	}
+	entries.reserve(count);
+	for (auto i{0u}; i < count && in; ++i) {
+		auto entry = Entry{};
+		auto gamepad = std::uint8_t{};
+		read(in, entry.tick);
+		read(in, entry.frame.controls);
+		read(in, entry.frame.throttle.x);
+		read(in, entry.frame.throttle.y);
+		read(in, gamepad);
+		entry.frame.gamepad = gamepad != 0;
+		entries.push_back(entry);
+	}
+	rewind();
+	if (!in) {
+		std::cout << "> replay " << path.string() << " is truncated\n";
+		return false;
+	}
+	return true;
+}
+
+} // namespace config
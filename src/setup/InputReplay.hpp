@@ -0,0 +1,46 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+#include "ControllerMap.hpp"
+
+namespace config {
+
+// records the per-tick controller state stream and plays it back in place of live events.
+// only ticks where the state changes are stored, so idle stretches cost nothing.
+// together with the random seed and starting room, a replay reproduces the same simulation tick for tick.
+class InputReplay {
+  public:
+	void start_recording(std::uint32_t seed, int room, sf::Vector2<float> position);
+	void record(ControllerMap const& controller);
+	void play(ControllerMap& controller);
+	void rewind() { cursor = tick = 0; }
+
+	bool save(std::filesystem::path const& path) const;
+	bool load(std::filesystem::path const& path);
+
+	[[nodiscard]] auto get_seed() const -> std::uint32_t { return header.seed; }
+	[[nodiscard]] auto get_room() const -> int { return header.room; }
+	[[nodiscard]] auto get_start_position() const -> sf::Vector2<float> { return header.position; }
+	[[nodiscard]] auto get_length() const -> std::uint32_t { return header.length; }
+	[[nodiscard]] auto finished() const -> bool { return tick >= header.length; }
+
+  private:
+	struct Entry {
+		std::uint32_t tick{};
+		InputFrame frame{};
+	};
+	struct {
+		std::uint32_t seed{};
+		std::int32_t room{};
+		sf::Vector2<float> position{};
+		std::uint32_t length{};
+	} header{};
+	std::vector<Entry> entries{};
+	std::size_t cursor{};
+	std::uint32_t tick{};
+};
+
+} // namespace config
@@ -0,0 +1,399 @@
+#include "LevelPack.hpp"
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include "../utils/Hash.hpp"
+
+namespace data {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::array<char, 4> magic{'F', 'L', 'V', 'P'};
+constexpr std::array<std::string_view, 3> sources{"meta.json", "tile.json", "inspectables.json"};
+static_assert(sizeof(int) == 4 && sizeof(float) == 4, "the level pack stores ints and floats as 32 bits");
+
+enum CellFlags : std::uint8_t { cell_surrounded = 1 << 0, cell_ramp_adjacent = 1 << 1 };
+
+// a missing file stamps as zero, so a room without inspectables.json stays fresh.
+// loads only stat the sources. the contents are hashed when the write time disagrees but the size doesn't,
+// since checkouts and copies touch write times without changing anything.
+struct Stamp {
+	std::uint64_t size{};
+	std::int64_t write_time{};
+	std::uint64_t hash{};
+};
+
+struct Ramp {
+	std::uint32_t layer{};
+	std::uint32_t index{};
+	std::array<sf::Vector2<float>, 4> vertices{};
+	bool big{};
+};
+
+auto read_text(fs::path const& path) -> std::string {
+	auto file = std::ifstream{path, std::ios::binary};
+	return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+auto get_stamp(fs::path const& path) -> Stamp {
+	auto error = std::error_code{};
+	if (!fs::is_regular_file(path, error)) { return {}; }
+	auto const text = read_text(path);
+	return {text.size(), fs::last_write_time(path, error).time_since_epoch().count(), util::get_hash(text)};
+}
+
+auto matches(Stamp const& stamp, fs::path const& path) -> bool {
+	auto error = std::error_code{};
+	auto const size = fs::file_size(path, error);
+	if (error) { return stamp.size == 0 && stamp.hash == 0; }
+	if (size != stamp.size) { return false; }
+	if (fs::last_write_time(path, error).time_since_epoch().count() == stamp.write_time && !error) { return true; }
+	return util::get_hash(read_text(path)) == stamp.hash;
+}
+
+// the field lists below are shared by Writer and Reader, so the two can't drift apart
+template <typename Archive, typename... Ts>
+void each(Archive& ar, Ts&... values) {
+	(ar(values), ...);
+}
+
+template <typename A>
+void fields(A& ar, Stamp& s) { each(ar, s.size, s.write_time, s.hash); }
+template <typename A>
+void fields(A& ar, Ramp& r) { each(ar, r.layer, r.index, r.vertices, r.big); }
+template <typename A>
+void fields(A& ar, RoomMeta& m) { each(ar, m.room_id, m.metagrid, m.dimensions, m.chunk_dimensions, m.style, m.background, m.breakables, m.pushables, m.music); }
+template <typename A>
+void fields(A& ar, NpcPlacement& p) { each(ar, p.position, p.id, p.background, p.suites); }
+template <typename A>
+void fields(A& ar, ChestPlacement& p) { each(ar, p.position, p.id, p.item_id, p.amount, p.rarity, p.type); }
+template <typename A>
+void fields(A& ar, AnimatorPlacement& p) { each(ar, p.position, p.dimensions, p.id, p.style, p.automatic, p.foreground); }
+template <typename A>
+void fields(A& ar, InspectablePlacement& p) { each(ar, p.position, p.dimensions, p.key, p.alternates, p.native_id, p.activate_on_contact); }
+template <typename A>
+void fields(A& ar, EnemyPlacement& p) { each(ar, p.position, p.id); }
+template <typename A>
+void fields(A& ar, DestroyerPlacement& p) { each(ar, p.position, p.quest_id); }
+template <typename A>
+void fields(A& ar, PortalPlacement& p) { each(ar, p.position, p.dimensions, p.source_id, p.destination_id, p.key_id, p.activate_on_contact, p.locked); }
+template <typename A>
+void fields(A& ar, PlatformPlacement& p) { each(ar, p.position, p.dimensions, p.extent, p.start, p.type, p.style); }
+template <typename A>
+void fields(A& ar, SwitchPlacement& p) { each(ar, p.position, p.type, p.button_id); }
+template <typename A>
+void fields(A& ar, RoomPlacements& p) {
+	each(ar, p.meta, p.npcs, p.chests, p.animators, p.beds, p.inspectables, p.enemies, p.destroyers, p.portals, p.save_point, p.platforms, p.switch_blocks, p.switches);
+}
+
+class Writer {
+  public:
+	template <typename T>
+	void operator()(T& value) {
+		if constexpr (std::is_same_v<T, bool>) {
+			append(static_cast<std::uint8_t>(value ? 1 : 0));
+		} else if constexpr (std::is_arithmetic_v<T>) {
+			append(value);
+		} else {
+			fields(*this, value);
+		}
+	}
+	void operator()(std::string& value) {
+		append(static_cast<std::uint32_t>(value.size()));
+		append(value.data(), value.size());
+	}
+	template <typename T>
+	void operator()(sf::Vector2<T>& value) { each(*this, value.x, value.y); }
+	template <typename T>
+	void operator()(sf::Rect<T>& value) { each(*this, value.left, value.top, value.width, value.height); }
+	template <typename T, std::size_t N>
+	void operator()(std::array<T, N>& values) {
+		for (auto& value : values) { (*this)(value); }
+	}
+	template <typename T>
+	void operator()(std::vector<T>& values) {
+		append(static_cast<std::uint32_t>(values.size()));
+		for (auto& value : values) { (*this)(value); }
+	}
+	template <typename T>
+	void operator()(std::optional<T>& value) {
+		auto present = value.has_value();
+		(*this)(present);
+		if (value) { (*this)(*value); }
+	}
+
+	template <typename T>
+	void append(T const& value) { append(&value, sizeof(T)); }
+	void append(void const* source, std::size_t count) {
+		auto const* first = static_cast<std::byte const*>(source);
+		bytes.insert(bytes.end(), first, first + count);
+	}
+
+	std::vector<std::byte> bytes{};
+};
+
+// reads are bounds checked and throw std::out_of_range, so a truncated or corrupt pack reads as stale
+class Reader {
+  public:
+	explicit Reader(std::span<std::byte const> bytes) : bytes(bytes) {}
+
+	template <typename T>
+	void operator()(T& value) {
+		if constexpr (std::is_same_v<T, bool>) {
+			value = read<std::uint8_t>() != 0;
+		} else if constexpr (std::is_arithmetic_v<T>) {
+			std::memcpy(&value, take(sizeof(T)), sizeof(T));
+		} else {
+			fields(*this, value);
+		}
+	}
+	void operator()(std::string& value) {
+		auto const size = read<std::uint32_t>();
+		value.assign(reinterpret_cast<char const*>(take(size)), size);
+	}
+	template <typename T>
+	void operator()(sf::Vector2<T>& value) { each(*this, value.x, value.y); }
+	template <typename T>
+	void operator()(sf::Rect<T>& value) { each(*this, value.left, value.top, value.width, value.height); }
+	template <typename T, std::size_t N>
+	void operator()(std::array<T, N>& values) {
+		for (auto& value : values) { (*this)(value); }
+	}
+	template <typename T>
+	void operator()(std::vector<T>& values) {
+		auto const count = read<std::uint32_t>();
+		if (count > remaining()) { throw std::out_of_range("level pack count runs past the end"); }
+		values.resize(count);
+		for (auto& value : values) { (*this)(value); }
+	}
+	template <typename T>
+	void operator()(std::optional<T>& value) {
+		value.reset();
+		if (read<bool>()) { (*this)(value.emplace()); }
+	}
+
+	template <typename T>
+	[[nodiscard]] auto read() -> T {
+		auto value = T{};
+		(*this)(value);
+		return value;
+	}
+	auto take(std::size_t count) -> std::byte const* {
+		if (count > remaining()) { throw std::out_of_range("level pack read past the end"); }
+		auto const* first = bytes.data() + cursor;
+		cursor += count;
+		return first;
+	}
+	[[nodiscard]] auto remaining() const -> std::size_t { return bytes.size() - cursor; }
+
+  private:
+	std::span<std::byte const> bytes;
+	std::size_t cursor{};
+};
+
+// reads the stamps at the front of a room and compares them with its sources
+auto is_fresh(Reader& in, fs::path const& source) -> bool {
+	for (auto const& name : sources) {
+		if (!matches(in.read<Stamp>(), source / name)) { return false; }
+	}
+	return true;
+}
+
+auto pack_room(fs::path const& source) -> std::optional<std::vector<std::byte>> {
+	auto const metadata = dj::Json::from_file((source / "meta.json").string().c_str());
+	auto const tiles = dj::Json::from_file((source / "tile.json").string().c_str());
+	if (metadata.is_null() || tiles.is_null()) { return {}; }
+
+	auto out = Writer{};
+	for (auto const& name : sources) {
+		auto stamp = get_stamp(source / name);
+		out(stamp);
+	}
+	auto placements = read_placements(metadata);
+	auto dialog = read_text(source / "inspectables.json");
+	each(out, placements, dialog);
+
+	auto const dimensions = sf::Vector2<uint32_t>{placements.meta.dimensions};
+	auto layers = read_layers(tiles, dimensions, world::NUM_LAYERS);
+	out.append(dimensions.x);
+	out.append(dimensions.y);
+	out.append(static_cast<std::uint32_t>(layers.size()));
+	for (auto const& grid : layers) {
+		for (std::uint32_t i{0}; i < grid.size(); ++i) { out.append(grid.plane.get(i)); }
+	}
+
+	auto ramps = std::vector<Ramp>{};
+	for (std::uint32_t layer{0}; layer < layers.size(); ++layer) {
+		for (auto const& cell : layers.at(layer).cells) {
+			if (!cell.is_ramp() || cell.bounding_box.vertices.size() < 4) { continue; }
+			auto& ramp = ramps.emplace_back(Ramp{layer, cell.one_d_index});
+			for (auto i{0}; i < 4; ++i) { ramp.vertices[i] = cell.bounding_box.vertices[i]; }
+			ramp.big = cell.is_big_ramp();
+		}
+	}
+	out(ramps);
+
+	auto& collidable = layers.at(world::MIDDLEGROUND);
+	collidable.build_collision();
+	out.append(static_cast<std::uint32_t>(world::MIDDLEGROUND));
+	for (std::uint32_t i{0}; i < collidable.size(); ++i) {
+		auto flags = std::uint8_t{};
+		if (auto const* cell = collidable.find(i)) {
+			if (cell->surrounded) { flags |= cell_surrounded; }
+			if (cell->ramp_adjacent()) { flags |= cell_ramp_adjacent; }
+		}
+		out.append(flags);
+	}
+	auto areas = collidable.get_block_areas();
+	each(out, collidable.drop_heights, areas);
+	return std::move(out.bytes);
+}
+
+} // namespace
+
+bool LevelPack::open(fs::path const& path) {
+	close();
+	if (!file.open(path)) { return false; }
+	try {
+		auto in = Reader{file.bytes()};
+		auto header = std::array<char, 4>{};
+		in(header);
+		if (header != magic || in.read<std::uint32_t>() != version) {
+			close();
+			return false;
+		}
+		auto const count = in.read<std::uint32_t>();
+		for (std::uint32_t i{0}; i < count; ++i) {
+			auto label = in.read<std::string>();
+			auto const offset = in.read<std::uint64_t>();
+			auto const size = in.read<std::uint64_t>();
+			if (offset > file.bytes().size() || size > file.bytes().size() - offset) { throw std::out_of_range("level pack room lies past the end"); }
+			rooms.emplace(std::move(label), file.bytes().subspan(offset, size));
+		}
+	} catch (std::out_of_range const&) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+void LevelPack::close() {
+	rooms.clear();
+	file.close();
+}
+
+bool LevelPack::load(std::string const& label, fs::path const& source, MapData& out, std::vector<world::Grid>& layers) const {
+	auto const room = rooms.find(label);
+	if (room == rooms.end()) { return false; }
+	try {
+		auto in = Reader{room->second};
+		if (!is_fresh(in, source)) { return false; }
+		in(out.placements);
+		out.inspectable_data = dj::Json::parse(in.read<std::string>());
+
+		auto const dimensions = sf::Vector2<uint32_t>{in.read<std::uint32_t>(), in.read<std::uint32_t>()};
+		auto const num_layers = in.read<std::uint32_t>();
+		auto const cell_count = std::size_t{dimensions.x} * dimensions.y;
+		if (cell_count * num_layers > in.remaining()) { return false; }
+		layers.clear();
+		layers.reserve(num_layers);
+		for (std::uint32_t layer{0}; layer < num_layers; ++layer) {
+			auto& grid = layers.emplace_back(dimensions);
+			auto const* plane = in.take(cell_count);
+			for (std::uint32_t i{0}; i < cell_count; ++i) { grid.plane.set(i, static_cast<std::uint8_t>(plane[i])); }
+		}
+
+		auto const ramps = in.read<std::vector<Ramp>>();
+		auto const collidable = in.read<std::uint32_t>();
+		if (collidable >= layers.size()) { return false; }
+		auto& grid = layers[collidable];
+		grid.make_collidable();
+		// packs from before the side table carry ramps for every layer. only the collidable layer has tiles to shape.
+		for (auto const& ramp : ramps) {
+			if (ramp.layer >= layers.size() || ramp.index >= cell_count) { return false; }
+			if (ramp.layer == collidable) { grid.seed_ramp(ramp.index, ramp.vertices, ramp.big); }
+		}
+		auto const* flags = in.take(cell_count);
+		for (std::uint32_t i{0}; i < cell_count; ++i) {
+			auto* tile = grid.find(i);
+			if (!tile) { continue; }
+			auto const cell = static_cast<std::uint8_t>(flags[i]);
+			tile->surrounded = cell & cell_surrounded;
+			if (cell & cell_ramp_adjacent) { tile->flags.set(world::TileState::ramp_adjacent); }
+		}
+		auto drops = in.read<std::vector<int>>();
+		auto const areas = in.read<std::vector<sf::Rect<int>>>();
+		for (auto const& area : areas) {
+			if (area.left < 0 || area.top < 0 || area.width < 1 || area.height < 1 || area.left + area.width > static_cast<int>(dimensions.x) || area.top + area.height > static_cast<int>(dimensions.y)) { return false; }
+		}
+		grid.restore_collision(std::move(drops), areas);
+	} catch (std::out_of_range const&) { return false; }
+	return true;
+}
+
+bool LevelPack::load_placements(std::string const& label, fs::path const& source, RoomPlacements& out) const {
+	auto const room = rooms.find(label);
+	if (room == rooms.end()) { return false; }
+	try {
+		auto in = Reader{room->second};
+		if (!is_fresh(in, source)) { return false; }
+		in(out);
+	} catch (std::out_of_range const&) { return false; }
+	return true;
+}
+
+auto LevelPack::compile(fs::path const& level_path, std::vector<std::string> const& labels, fs::path const& out) -> std::size_t {
+	auto packed = std::vector<std::pair<std::string, std::vector<std::byte>>>{};
+	for (auto const& label : labels) {
+		if (auto room = pack_room(level_path / label)) { packed.emplace_back(label, std::move(*room)); }
+	}
+
+	// the directory's size is known up front, so each room's offset can be written before the rooms themselves
+	auto header = Writer{};
+	auto directory_size = sizeof(magic) + 2 * sizeof(std::uint32_t);
+	for (auto const& [label, bytes] : packed) { directory_size += sizeof(std::uint32_t) + label.size() + 2 * sizeof(std::uint64_t); }
+	header.append(magic);
+	header.append(version);
+	header.append(static_cast<std::uint32_t>(packed.size()));
+	auto offset = static_cast<std::uint64_t>(directory_size);
+	for (auto& [label, bytes] : packed) {
+		header(label);
+		header.append(offset);
+		header.append(static_cast<std::uint64_t>(bytes.size()));
+		offset += bytes.size();
+	}
+	assert(header.bytes.size() == directory_size);
+
+	auto contents = std::string{};
+	contents.append(reinterpret_cast<char const*>(header.bytes.data()), header.bytes.size());
+	for (auto const& [label, bytes] : packed) { contents.append(reinterpret_cast<char const*>(bytes.data()), bytes.size()); }
+	// the build runs this every time, so an unchanged pack is left alone
+	if (read_text(out) == contents) { return packed.size(); }
+
+	// a running game may have the old pack mapped, and truncating a mapped file kills it on the next read. the new pack is
+	// written beside it and renamed over it instead, which leaves existing mappings on the old file.
+	auto temp = out;
+	temp += ".tmp";
+	{
+		auto file = std::ofstream{temp, std::ios::binary | std::ios::trunc};
+		if (!file) { return 0; }
+		file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+		if (!file.flush()) { return 0; }
+	}
+	auto error = std::error_code{};
+	fs::rename(temp, out, error);
+	if (error) {
+		fs::remove(temp, error);
+		return 0;
+	}
+	return packed.size();
+}
+
+} // namespace data
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "RoomData.hpp"
+#include "../utils/MappedFile.hpp"
+
+namespace data {
+
+// every room under resources/level compiled into one binary file by fornani_levelpack.
+// the json in each room's folder stays the authoring format: a room whose sources changed after it was packed is left to the json path.
+//
+// layout, little endian, offsets from the start of the file:
+//   header     "FLVP", u32 version, u32 room count
+//   directory  per room: label, u64 offset, u64 size
+//   room       size, write time and content hash of each source file, placement records, the dialog json as text,
+//              u32 width, u32 height, u32 layer count, one u8 plane per layer, ramp polygons,
+//              then the collidable layer's neighbour flags, drop heights and block rects
+class LevelPack {
+  public:
+	static constexpr std::uint32_t version{3};
+	static constexpr std::string_view filename{"rooms.pack"};
+
+	// maps the pack and reads its directory. returns false if it is missing, truncated or from another version.
+	bool open(std::filesystem::path const& path);
+	void close();
+	// builds a room straight from the mapped pack. returns false if the room isn't packed or source (its folder) changed since,
+	// in which case out and layers must be refilled from json.
+	bool load(std::string const& label, std::filesystem::path const& source, MapData& out, std::vector<world::Grid>& layers) const;
+	// reads only the placement records, for callers that don't need the tiles
+	bool load_placements(std::string const& label, std::filesystem::path const& source, RoomPlacements& out) const;
+
+	[[nodiscard]] auto is_open() const -> bool { return file.is_open(); }
+	[[nodiscard]] auto size() const -> std::size_t { return rooms.size(); }
+
+	// packs level_path/<label> for each label into out, skipping rooms without meta.json or tile.json. returns the number packed.
+	// out is replaced in one rename, so a game that has it open keeps reading the old pack.
+	static auto compile(std::filesystem::path const& level_path, std::vector<std::string> const& labels, std::filesystem::path const& out) -> std::size_t;
+
+  private:
+	util::MappedFile file{};
+	std::unordered_map<std::string, std::span<std::byte const>> rooms{};
+};
+
+} // namespace data
@@ -0,0 +1,170 @@
+#include "RoomCache.hpp"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+
+namespace data {
+
+namespace {
+
+auto make_outline(RoomPlacements const& placements) -> RoomOutline { return {placements.meta, placements.portals, placements.save_point}; }
+
+auto make_outline(Room& room) -> RoomOutline {
+	auto ret = make_outline(room.data.placements);
+	auto& grid = room.layers.at(world::MIDDLEGROUND).grid;
+	grid.build_collision();
+	for (auto const& cell : grid.cells) {
+		if (!cell.is_occupied()) { continue; }
+		if (cell.is_breakable()) {
+			ret.breakables.push_back(cell.scaled_position);
+			continue;
+		}
+		ret.tiles.push_back({cell.scaled_position, cell.value, cell.surrounded});
+	}
+	ret.detailed = true;
+	return ret;
+}
+
+} // namespace
+
+RoomCache& RoomCache::operator=(RoomCache&& other) noexcept {
+	if (this == &other) { return *this; }
+	clear();
+	other.pending.clear();
+	pack = std::move(other.pack);
+	level_path = std::move(other.level_path);
+	labels = std::move(other.labels);
+	rooms = std::move(other.rooms);
+	outlines = std::move(other.outlines);
+	capacity = other.capacity;
+	return *this;
+}
+
+void RoomCache::open(std::filesystem::path path, std::unordered_map<int, std::string> room_labels) {
+	clear();
+	level_path = std::move(path);
+	labels = std::move(room_labels);
+	pack.open(level_path / LevelPack::filename);
+}
+
+void RoomCache::clear() {
+	pending.clear(); // waits for reads still running, since they use the pack
+	rooms.clear();
+	outlines.clear();
+	pack.close();
+}
+
+auto RoomCache::get(int id) -> Room& {
+	if (auto it = std::find_if(rooms.begin(), rooms.end(), [id](auto const& room) { return room.first == id; }); it != rooms.end()) {
+		rooms.splice(rooms.begin(), rooms, it);
+		return *rooms.front().second;
+	}
+	auto room = std::unique_ptr<Room>{};
+	if (auto it = pending.find(id); it != pending.end()) {
+		room = it->second.get();
+		pending.erase(it);
+	} else {
+		room = read(id);
+	}
+	rooms.emplace_front(id, std::move(room));
+	while (rooms.size() > std::max(capacity, std::size_t{1})) { rooms.pop_back(); }
+	return *rooms.front().second;
+}
+
+void RoomCache::prefetch_neighbours(int id) {
+	auto neighbours = std::vector<int>{};
+	for (auto const& portal : get(id).data.placements.portals) {
+		auto const destination = portal.destination_id;
+		if (destination == id || !labels.contains(destination) || is_resident(destination)) { continue; }
+		if (std::find(neighbours.begin(), neighbours.end(), destination) == neighbours.end()) { neighbours.push_back(destination); }
+	}
+	// reads nobody asked for are dropped once they finish. running ones are left for next time, so this never waits.
+	std::erase_if(pending, [&neighbours](auto& entry) {
+		return std::find(neighbours.begin(), neighbours.end(), entry.first) == neighbours.end() && entry.second.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+	});
+	for (auto const destination : neighbours) {
+		if (pending.contains(destination)) { continue; }
+		pending.emplace(destination, std::async(std::launch::async, [this, destination] { return read(destination); }));
+	}
+}
+
+auto RoomCache::get_outline(int id, bool detailed) -> RoomOutline const& {
+	if (auto it = outlines.find(id); it != outlines.end() && (it->second.detailed || !detailed)) { return it->second; }
+	auto& outline = outlines[id];
+	if (!detailed) {
+		outline = make_outline(peek(id));
+	} else if (auto* room = find(id)) {
+		outline = make_outline(*room);
+	} else {
+		outline = make_outline(*read(id));
+	}
+	return outline;
+}
+
+void RoomCache::print_memory(std::ostream& out) const {
+	auto const kb = [](std::size_t bytes) { return static_cast<float>(bytes) / 1024.f; };
+	// the layout before tile planes: a full tile, as a plain cell is constructed, on every cell of every layer
+	auto const tile_bytes = world::Tile({}, {}, 0).memory();
+	auto const flags = out.flags();
+	auto const precision = out.precision();
+	out << std::fixed << std::setprecision(1);
+	out << "> room memory, against " << tile_bytes << " bytes per tile on every cell of every layer\n";
+	for (auto const& [id, room] : rooms) {
+		auto now = world::Grid::Footprint{};
+		auto before = std::size_t{};
+		for (auto const& layer : room->layers) {
+			auto const footprint = layer.grid.memory();
+			now.plane += footprint.plane;
+			now.tiles += footprint.tiles;
+			now.tables += footprint.tables;
+			before += layer.grid.size() * tile_bytes + footprint.tables;
+		}
+		auto const& dimensions = room->data.placements.meta.dimensions;
+		out << "  room " << id << " (" << dimensions.x << "x" << dimensions.y << ", " << room->layers.size() << " layers): " << kb(now.total()) << "kb";
+		out << " [planes " << kb(now.plane) << ", tiles " << kb(now.tiles) << ", collision " << kb(now.tables) << "], was " << kb(before) << "kb";
+		out << " (" << static_cast<float>(before) / static_cast<float>(std::max(now.total(), std::size_t{1})) << "x)\n";
+	}
+	out.flags(flags);
+	out.precision(precision);
+}
+
+auto RoomCache::read(int id) const -> std::unique_ptr<Room> {
+	auto const& label = labels.at(id);
+	auto const source = level_path / label;
+	auto ret = std::make_unique<Room>();
+	ret->data.id = id;
+	auto grids = std::vector<world::Grid>{};
+	if (!pack.load(label, source, ret->data, grids)) {
+		auto const metadata = dj::Json::from_file((source / "meta.json").string().c_str());
+		assert(!metadata.is_null());
+		auto const tiles = dj::Json::from_file((source / "tile.json").string().c_str());
+		assert(!tiles.is_null());
+		ret->data.placements = read_placements(metadata);
+		ret->data.inspectable_data = dj::Json::from_file((source / "inspectables.json").string().c_str());
+		grids = read_layers(tiles, sf::Vector2<uint32_t>{ret->data.placements.meta.dimensions}, world::NUM_LAYERS);
+	}
+	for (auto& grid : grids) {
+		auto& layer = ret->layers.emplace_back();
+		layer.render_order = static_cast<uint8_t>(ret->layers.size() - 1);
+		layer.collidable = layer.render_order == world::MIDDLEGROUND;
+		layer.dimensions = grid.dimensions;
+		layer.grid = std::move(grid);
+	}
+	return ret;
+}
+
+auto RoomCache::peek(int id) const -> RoomPlacements {
+	auto const& label = labels.at(id);
+	auto const source = level_path / label;
+	auto ret = RoomPlacements{};
+	if (pack.load_placements(label, source, ret)) { return ret; }
+	return read_placements(dj::Json::from_file((source / "meta.json").string().c_str()));
+}
+
+auto RoomCache::find(int id) const -> Room* {
+	auto it = std::find_if(rooms.begin(), rooms.end(), [id](auto const& room) { return room.first == id; });
+	return it == rooms.end() ? nullptr : it->second.get();
+}
+
+} // namespace data
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <future>
+#include <list>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "LevelPack.hpp"
+#include "RoomData.hpp"
+#include "../level/Map.hpp"
+
+namespace data {
+
+struct Room {
+	MapData data{};
+	std::vector<world::Layer> layers{};
+};
+
+// rooms are read when first asked for and kept in a short most-recently-used list, so startup time and resident memory
+// follow the rooms being visited rather than the whole world. once the list is full the least recent room is released.
+// the room a get returns is never the one released, but references to other rooms don't survive a get that misses.
+class RoomCache {
+  public:
+	static constexpr std::size_t default_capacity{4};
+
+	RoomCache() = default;
+	RoomCache(RoomCache&& other) noexcept { *this = std::move(other); }
+	// pending reads point at the cache that started them, so moving waits for other's to finish
+	RoomCache& operator=(RoomCache&& other) noexcept;
+
+	void open(std::filesystem::path path, std::unordered_map<int, std::string> room_labels);
+	void clear();
+	// reads the room if it isn't resident, adopting a prefetched copy if one is pending. this reorders the list,
+	// so it belongs on the main thread: loading a room, or anything else that runs while nothing else is looking.
+	auto get(int id) -> Room&;
+	// the room if it is resident, without touching the order. several threads may call this at once as long as none calls get.
+	[[nodiscard]] auto find(int id) const -> Room*;
+	// starts reading the rooms id's portals lead to on a worker thread. they stay pending until someone asks for them.
+	void prefetch_neighbours(int id);
+	// what the minimap needs of a room. only detailed outlines read tiles, and a room that isn't resident is read and released again.
+	auto get_outline(int id, bool detailed) -> RoomOutline const&;
+
+	[[nodiscard]] auto is_resident(int id) const -> bool { return find(id) != nullptr; }
+	[[nodiscard]] auto is_pending(int id) const -> bool { return pending.contains(id); }
+	[[nodiscard]] auto resident() const -> std::size_t { return rooms.size(); }
+	[[nodiscard]] auto is_packed() const -> bool { return pack.is_open(); }
+	// what each resident room's layers hold, against the one full tile per cell on every layer they used to cost
+	void print_memory(std::ostream& out) const;
+
+	std::size_t capacity{default_capacity};
+
+  private:
+	// safe to call from any thread, since it only reads the pack and the room's files
+	[[nodiscard]] auto read(int id) const -> std::unique_ptr<Room>;
+	[[nodiscard]] auto peek(int id) const -> RoomPlacements;
+
+	LevelPack pack{};
+	std::filesystem::path level_path{};
+	std::unordered_map<int, std::string> labels{};
+	std::list<std::pair<int, std::unique_ptr<Room>>> rooms{}; // most recently used first
+	std::unordered_map<int, std::future<std::unique_ptr<Room>>> pending{};
+	std::unordered_map<int, RoomOutline> outlines{};
+};
+
+} // namespace data
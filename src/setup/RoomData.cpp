@@ -0,0 +1,104 @@
+#include "RoomData.hpp"
+
+namespace data {
+
+namespace {
+
+auto read_vector_int(dj::Json const& json) -> sf::Vector2<int> { return {json[0].as<int>(), json[1].as<int>()}; }
+auto read_vector_float(dj::Json const& json) -> sf::Vector2<float> { return {json[0].as<float>(), json[1].as<float>()}; }
+
+} // namespace
+
+auto read_placements(dj::Json const& metadata) -> RoomPlacements {
+	auto ret = RoomPlacements{};
+
+	auto const& meta = metadata["meta"];
+	ret.meta.room_id = meta["room_id"].as<int>();
+	ret.meta.metagrid = read_vector_int(meta["metagrid"]);
+	ret.meta.dimensions = read_vector_int(meta["dimensions"]);
+	ret.meta.chunk_dimensions = read_vector_int(meta["chunk_dimensions"]);
+	ret.meta.style = meta["style"].as<int>();
+	ret.meta.background = meta["background"].as<int>();
+	ret.meta.breakables = meta["styles"]["breakables"].as<int>();
+	ret.meta.pushables = meta["styles"]["pushables"].as<int>();
+	if (meta["music"].is_string()) { ret.meta.music = meta["music"].as_string(); }
+
+	for (auto const& entry : metadata["npcs"].array_view()) {
+		auto& npc = ret.npcs.emplace_back();
+		npc.position = read_vector_float(entry["position"]);
+		npc.id = entry["id"].as<int>();
+		npc.background = static_cast<bool>(entry["background"].as_bool());
+		for (auto const& suite : entry["suites"].array_view()) {
+			auto& conversations = npc.suites.emplace_back();
+			for (auto const& convo : suite.array_view()) { conversations.push_back(convo.as_string()); }
+		}
+	}
+	for (auto const& entry : metadata["chests"].array_view()) {
+		ret.chests.push_back({read_vector_float(entry["position"]), entry["id"].as<int>(), entry["item_id"].as<int>(), entry["amount"].as<int>(), entry["rarity"].as<float>(), entry["type"].as<int>()});
+	}
+	for (auto const& entry : metadata["animators"].array_view()) {
+		auto& animator = ret.animators.emplace_back();
+		animator.position = read_vector_int(entry["position"]);
+		animator.dimensions = read_vector_int(entry["dimensions"]);
+		animator.id = entry["id"].as<int>();
+		animator.style = entry["style"].as<int>();
+		animator.automatic = static_cast<bool>(entry["automatic"].as_bool());
+		animator.foreground = static_cast<bool>(entry["foreground"].as_bool());
+	}
+	for (auto const& entry : metadata["beds"].array_view()) { ret.beds.push_back(read_vector_float(entry["position"])); }
+	for (auto const& entry : metadata["inspectables"].array_view()) {
+		auto& inspectable = ret.inspectables.emplace_back();
+		inspectable.position = read_vector_int(entry["position"]);
+		inspectable.dimensions = read_vector_int(entry["dimensions"]);
+		inspectable.key = entry["key"].as_string();
+		inspectable.alternates = entry["alternates"].as<int>();
+		inspectable.native_id = entry["native_id"].as<int>();
+		inspectable.activate_on_contact = static_cast<bool>(entry["activate_on_contact"].as_bool());
+	}
+	for (auto const& entry : metadata["enemies"].array_view()) { ret.enemies.push_back({read_vector_int(entry["position"]), entry["id"].as<int>()}); }
+	for (auto const& entry : metadata["destroyers"].array_view()) { ret.destroyers.push_back({read_vector_int(entry["position"]), entry["quest_id"].as<int>()}); }
+	for (auto const& entry : metadata["portals"].array_view()) {
+		auto& portal = ret.portals.emplace_back();
+		portal.position = read_vector_int(entry["position"]);
+		portal.dimensions = read_vector_int(entry["dimensions"]);
+		portal.source_id = entry["source_id"].as<int>();
+		portal.destination_id = entry["destination_id"].as<int>();
+		portal.key_id = entry["key_id"].as<int>();
+		portal.activate_on_contact = static_cast<bool>(entry["activate_on_contact"].as_bool());
+		portal.locked = static_cast<bool>(entry["locked"].as_bool());
+	}
+	if (auto const& savept = metadata["save_point"]; savept.contains("position")) { ret.save_point = read_vector_int(savept["position"]); }
+	for (auto const& entry : metadata["platforms"].array_view()) {
+		auto& platform = ret.platforms.emplace_back();
+		platform.position = read_vector_float(entry["position"]);
+		platform.dimensions = read_vector_float(entry["dimensions"]);
+		platform.extent = entry["extent"].as<float>();
+		platform.start = entry["start"].as<float>();
+		platform.type = entry["type"].as_string();
+		platform.style = entry["style"].as<int>();
+	}
+	for (auto const& entry : metadata["switch_blocks"].array_view()) { ret.switch_blocks.push_back({read_vector_float(entry["position"]), entry["type"].as<int>(), entry["button_id"].as<int>()}); }
+	for (auto const& entry : metadata["switches"].array_view()) { ret.switches.push_back({read_vector_float(entry["position"]), entry["type"].as<int>(), entry["button_id"].as<int>()}); }
+
+	return ret;
+}
+
+auto read_layers(dj::Json const& tiles, sf::Vector2<uint32_t> dimensions, int num_layers) -> std::vector<world::Grid> {
+	auto ret = std::vector<world::Grid>{};
+	ret.reserve(num_layers);
+	for (auto i{0}; i < num_layers; ++i) {
+		auto& grid = ret.emplace_back(dimensions);
+		auto cell_counter{0u};
+		for (auto const& cell : tiles["layers"][i].array_view()) {
+			if (cell_counter >= grid.size()) { break; }
+			grid.plane.set(cell_counter, static_cast<uint8_t>(cell.as<int>()));
+			++cell_counter;
+		}
+		if (i != world::MIDDLEGROUND) { continue; }
+		grid.make_collidable();
+		grid.seed_vertices();
+	}
+	return ret;
+}
+
+} // namespace data
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <djson/json.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "../level/Grid.hpp"
+
+namespace data {
+
+// typed copies of the records in a room's meta.json. Map::load builds the room from these, whether they came from json or a level pack.
+
+struct RoomMeta {
+	int room_id{};
+	sf::Vector2<int> metagrid{};
+	sf::Vector2<int> dimensions{};
+	sf::Vector2<int> chunk_dimensions{};
+	int style{};
+	int background{};
+	int breakables{};
+	int pushables{};
+	std::string music{}; // empty if the room keeps the current track
+};
+
+struct NpcPlacement {
+	sf::Vector2<float> position{};
+	int id{};
+	bool background{};
+	std::vector<std::vector<std::string>> suites{}; // one suite per quest progression
+};
+
+struct ChestPlacement {
+	sf::Vector2<float> position{};
+	int id{};
+	int item_id{};
+	int amount{};
+	float rarity{};
+	int type{};
+};
+
+struct AnimatorPlacement {
+	sf::Vector2<int> position{};
+	sf::Vector2<int> dimensions{};
+	int id{};
+	int style{};
+	bool automatic{};
+	bool foreground{};
+};
+
+struct InspectablePlacement {
+	sf::Vector2<int> position{};
+	sf::Vector2<int> dimensions{};
+	std::string key{};
+	int alternates{};
+	int native_id{};
+	bool activate_on_contact{};
+};
+
+struct EnemyPlacement {
+	sf::Vector2<int> position{};
+	int id{};
+};
+
+struct DestroyerPlacement {
+	sf::Vector2<int> position{};
+	int quest_id{};
+};
+
+struct PortalPlacement {
+	sf::Vector2<int> position{};
+	sf::Vector2<int> dimensions{};
+	int source_id{};
+	int destination_id{};
+	int key_id{};
+	bool activate_on_contact{};
+	bool locked{};
+};
+
+struct PlatformPlacement {
+	sf::Vector2<float> position{};
+	sf::Vector2<float> dimensions{};
+	float extent{};
+	float start{};
+	std::string type{};
+	int style{};
+};
+
+// switch blocks and switch buttons share a layout
+struct SwitchPlacement {
+	sf::Vector2<float> position{};
+	int type{};
+	int button_id{};
+};
+
+struct RoomPlacements {
+	RoomMeta meta{};
+	std::vector<NpcPlacement> npcs{};
+	std::vector<ChestPlacement> chests{};
+	std::vector<AnimatorPlacement> animators{};
+	std::vector<sf::Vector2<float>> beds{};
+	std::vector<InspectablePlacement> inspectables{};
+	std::vector<EnemyPlacement> enemies{};
+	std::vector<DestroyerPlacement> destroyers{};
+	std::vector<PortalPlacement> portals{};
+	std::optional<sf::Vector2<int>> save_point{};
+	std::vector<PlatformPlacement> platforms{};
+	std::vector<SwitchPlacement> switch_blocks{};
+	std::vector<SwitchPlacement> switches{};
+};
+
+struct MapData {
+	int id{};
+	RoomPlacements placements{};
+	dj::Json inspectable_data{};
+};
+
+// what the minimap draws of a room. tiles and breakables are only filled in once the room's layers have been read.
+struct RoomOutline {
+	struct Cell {
+		sf::Vector2<int> index{};
+		std::uint8_t value{};
+		bool surrounded{};
+	};
+	RoomMeta meta{};
+	std::vector<PortalPlacement> portals{};
+	std::optional<sf::Vector2<int>> save_point{};
+	std::vector<Cell> tiles{}; // occupied middleground cells, breakables aside
+	std::vector<sf::Vector2<int>> breakables{};
+	bool detailed{};
+};
+
+// missing keys decode to zero, exactly like reading them from the json in place
+[[nodiscard]] auto read_placements(dj::Json const& metadata) -> RoomPlacements;
+// one grid per layer from a room's tile.json. only the middleground is made collidable, with its ramp vertices seeded.
+[[nodiscard]] auto read_layers(dj::Json const& tiles, sf::Vector2<uint32_t> dimensions, int num_layers) -> std::vector<world::Grid>;
+
+} // namespace data
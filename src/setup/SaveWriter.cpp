@@ -0,0 +1,215 @@
+#include "SaveWriter.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../utils/Hash.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace data {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+auto with_suffix(fs::path path, char const* suffix) -> fs::path {
+	path += suffix;
+	return path;
+}
+
+auto get_temp(fs::path const& path) -> fs::path { return with_suffix(path, ".tmp"); }
+auto get_journal(fs::path const& path) -> fs::path { return with_suffix(path, ".journal"); }
+
+// the hash is enough to tell a complete temp file from a torn one
+auto describe(std::string_view bytes) -> std::string {
+	auto ret = std::to_string(bytes.size()) + " ";
+	auto const hash = util::get_hash(bytes);
+	for (auto shift{60}; shift >= 0; shift -= 4) { ret += "0123456789abcdef"[(hash >> shift) & 0xf]; }
+	return ret + "\n";
+}
+
+auto read_file(fs::path const& path) -> std::string {
+	auto in = std::ifstream{path, std::ios::binary};
+	return {std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+}
+
+#if defined(_WIN32)
+
+bool write_durably(fs::path const& path, std::string_view bytes) {
+	auto file = CreateFileW(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) { return false; }
+	auto written = DWORD{};
+	auto const ret = WriteFile(file, bytes.data(), static_cast<DWORD>(bytes.size()), &written, nullptr) && written == bytes.size() && FlushFileBuffers(file);
+	CloseHandle(file);
+	return ret;
+}
+
+// a rename is durable once MoveFileEx returns with MOVEFILE_WRITE_THROUGH
+bool replace(fs::path const& from, fs::path const& to) { return MoveFileExW(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH); }
+
+#else
+
+bool write_durably(fs::path const& path, std::string_view bytes) {
+	auto const file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (file < 0) { return false; }
+	auto ret{true};
+	for (std::size_t done{0}; ret && done < bytes.size();) {
+		auto const count = ::write(file, bytes.data() + done, bytes.size() - done);
+		if (count < 0 && errno == EINTR) { continue; }
+		ret = count > 0;
+		if (ret) { done += static_cast<std::size_t>(count); }
+	}
+	ret = ret && ::fsync(file) == 0;
+	return ::close(file) == 0 && ret;
+}
+
+// the rename itself lives in the directory, which needs its own fsync to survive a power cut
+bool replace(fs::path const& from, fs::path const& to) {
+	if (::rename(from.c_str(), to.c_str()) != 0) { return false; }
+	auto const parent = to.parent_path();
+	if (auto const directory = ::open(parent.empty() ? "." : parent.c_str(), O_RDONLY | O_DIRECTORY); directory >= 0) {
+		::fsync(directory);
+		::close(directory);
+	}
+	return true;
+}
+
+#endif
+
+bool commit(fs::path const& path, std::string_view bytes) {
+	auto const journal = get_journal(path);
+	if (!write_durably(get_temp(path), bytes)) { return false; }
+	if (!write_durably(journal, describe(bytes))) { return false; }
+	if (!replace(get_temp(path), path)) { return false; }
+	auto ec = std::error_code{};
+	fs::remove(journal, ec);
+	return true;
+}
+
+} // namespace
+
+struct SaveWriter::Worker {
+	struct Job {
+		fs::path path{};
+		dj::Json json{};
+		std::vector<Callback> callbacks{};
+	};
+
+	Worker() : thread([this] { run(); }) {}
+	~Worker() {
+		{
+			auto lock = std::scoped_lock{mutex};
+			stopping = true;
+		}
+		signal.notify_all();
+		thread.join();
+	}
+
+	// queued writes are still finished on the way out, so quitting right after a save keeps it
+	void run() {
+		for (;;) {
+			auto job = Job{};
+			{
+				auto lock = std::unique_lock{mutex};
+				signal.wait(lock, [this] { return !jobs.empty() || stopping; });
+				if (jobs.empty()) { return; }
+				job = std::move(jobs.front());
+				jobs.pop_front();
+				writing = true;
+			}
+			auto const saved = commit(job.path, job.json.serialize());
+			{
+				auto lock = std::scoped_lock{mutex};
+				writing = false;
+				for (auto& callback : job.callbacks) {
+					if (callback) { finished.emplace_back(std::move(callback), saved); }
+				}
+			}
+			signal.notify_all();
+		}
+	}
+
+	mutable std::mutex mutex{};
+	std::condition_variable signal{};
+	std::deque<Job> jobs{};
+	std::vector<std::pair<Callback, bool>> finished{};
+	bool writing{};
+	bool stopping{};
+	std::thread thread; // last, so it starts once everything it uses exists
+};
+
+SaveWriter::SaveWriter() = default;
+SaveWriter::~SaveWriter() = default;
+SaveWriter::SaveWriter(SaveWriter&&) noexcept = default;
+SaveWriter& SaveWriter::operator=(SaveWriter&&) noexcept = default;
+
+void SaveWriter::write(fs::path path, dj::Json json, Callback on_done) {
+	if (!worker) { worker = std::make_unique<Worker>(); }
+	{
+		auto lock = std::scoped_lock{worker->mutex};
+		auto& jobs = worker->jobs;
+		if (auto it = std::find_if(jobs.begin(), jobs.end(), [&path](auto const& job) { return job.path == path; }); it != jobs.end()) {
+			it->json = std::move(json);
+			it->callbacks.push_back(std::move(on_done));
+		} else {
+			jobs.push_back({std::move(path), std::move(json)});
+			jobs.back().callbacks.push_back(std::move(on_done));
+		}
+	}
+	worker->signal.notify_all();
+}
+
+void SaveWriter::poll() {
+	if (!worker) { return; }
+	auto finished = std::vector<std::pair<Callback, bool>>{};
+	{
+		auto lock = std::scoped_lock{worker->mutex};
+		std::swap(finished, worker->finished);
+	}
+	for (auto& [callback, saved] : finished) { callback(saved); }
+}
+
+void SaveWriter::flush() {
+	if (!worker) { return; }
+	auto lock = std::unique_lock{worker->mutex};
+	worker->signal.wait(lock, [this] { return worker->jobs.empty() && !worker->writing; });
+}
+
+auto SaveWriter::busy() const -> bool {
+	if (!worker) { return false; }
+	auto lock = std::scoped_lock{worker->mutex};
+	return !worker->jobs.empty() || worker->writing;
+}
+
+void SaveWriter::recover(fs::path const& path) {
+	auto const temp = get_temp(path);
+	auto const journal = get_journal(path);
+	auto ec = std::error_code{};
+	// the journal is only written once the temp file is complete, so a temp file that still matches it can be committed
+	if (fs::exists(journal, ec)) {
+		auto const expected = read_file(journal);
+		if (fs::exists(temp, ec) && describe(read_file(temp)) == expected) { replace(temp, path); }
+		fs::remove(journal, ec);
+	}
+	// a temp file without a journal never finished writing, and path still holds the last good save
+	fs::remove(temp, ec);
+}
+
+} // namespace data
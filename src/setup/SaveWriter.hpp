@@ -0,0 +1,40 @@
+#pragma once
+
+#include <djson/json.hpp>
+#include <filesystem>
+#include <functional>
+#include <memory>
+
+namespace data {
+
+// writes json files on a background thread, so saving never waits on the disk.
+// each write serializes a copy of the json taken when it was queued. the text goes to <path>.tmp, which is flushed to disk
+// and then renamed over path, so a crash at any point leaves either the old file or the new one. a small journal written
+// between the two names the finished temp file, and recover() commits or discards whatever the last session left behind.
+class SaveWriter {
+  public:
+	// true if the file reached the disk
+	using Callback = std::function<void(bool)>;
+
+	SaveWriter();
+	~SaveWriter();
+	SaveWriter(SaveWriter&&) noexcept;
+	SaveWriter& operator=(SaveWriter&&) noexcept;
+
+	// a write still waiting in the queue is replaced by a newer one to the same path, and both callbacks hear the result
+	void write(std::filesystem::path path, dj::Json json, Callback on_done = {});
+	// runs the callbacks of writes that finished since the last poll, on the calling thread
+	void poll();
+	// blocks until every queued write has finished
+	void flush();
+	[[nodiscard]] auto busy() const -> bool;
+
+	// call before reading path. finishes a rename the journal vouches for and removes stale temp files.
+	static void recover(std::filesystem::path const& path);
+
+  private:
+	struct Worker;
+	std::unique_ptr<Worker> worker; // started by the first write
+};
+
+} // namespace data
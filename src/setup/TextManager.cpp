@@ -22,6 +22,20 @@ void TextManager::load_data() {
 	//set font
 	text_font = finder.resource_path + "/text/fonts/pixelFJ8pt1.ttf";
 	title_font = finder.resource_path + "/text/fonts/kongtext.ttf";
+	fonts.text.loadFromFile(text_font);
+	fonts.text.setSmooth(false);
+	fonts.title.loadFromFile(title_font);
+	fonts.title.setSmooth(false);
+}
+
+void TextManager::warm_glyphs() {
+	for (auto const size : glyph_sizes) { warm_glyphs(size); }
+}
+
+void TextManager::warm_glyphs(unsigned size) {
+	for (auto* font : {&fonts.text, &fonts.title}) {
+		for (sf::Uint32 glyph{' '}; glyph <= '~'; ++glyph) { static_cast<void>(font->getGlyph(glyph, size, false)); }
+	}
 }
 
 } // namespace data
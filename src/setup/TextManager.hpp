@@ -2,6 +2,8 @@
 #pragma once
 
 #include <assert.h>
+#include <array>
+#include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <djson/json.hpp>
 #include <iostream>
@@ -13,7 +15,15 @@ namespace data {
 class TextManager {
 
 	public:
+	// every size text is drawn at outside the debug overlay, which stops the render thread while it is open
+	static constexpr std::array<unsigned, 2> glyph_sizes{16, 30};
+
 	void load_data();
+	// text is laid out on the simulation thread while the render thread samples the fonts' glyph pages. loading every
+	// printable glyph up front means laying out text only reads the pages, and they never grow while a frame is drawn.
+	// builds textures, so it runs on the thread that owns the context, before the renderer starts.
+	void warm_glyphs();
+	void warm_glyphs(unsigned size);
 
 	//jsons
 	dj::Json console{};
@@ -25,6 +35,12 @@ class TextManager {
 	std::string text_font{};
 	std::string title_font{};
 
+	// loaded once and shared by every text object, so fonts outlive any snapshot that draws with them
+	struct {
+		sf::Font text{};
+		sf::Font title{};
+	} fonts{};
+
 	ResourceFinder finder{};
 };
 
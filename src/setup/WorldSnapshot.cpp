@@ -0,0 +1,99 @@
+#include "WorldSnapshot.hpp"
+#include "../service/ServiceProvider.hpp"
+#include "../entities/player/Player.hpp"
+
+namespace data {
+
+namespace {
+
+constexpr int num_abilities{static_cast<int>(player::Abilities::shield) + 1};
+
+} // namespace
+
+void WorldSnapshot::capture(automa::ServiceProvider& svc, player::Player& player, int room_id) {
+	buffer.clear();
+	room = room_id;
+	file = svc.data.current_save;
+
+	svc.data.write_progress(buffer);
+	buffer.write(svc.state_controller.save_point_id);
+
+	buffer.write(player.collider.physics.position);
+	buffer.write(player.health.get_max());
+	buffer.write(player.health.get_hp());
+	buffer.write(player.player_stats.orbs);
+
+	auto loadout = std::vector<int>{};
+	auto equipped = std::size_t{};
+	if (player.arsenal) {
+		for (auto& gun : player.arsenal.value().get_loadout()) { loadout.push_back(gun->get_id()); }
+		equipped = player.arsenal.value().get_index();
+	}
+	buffer.write(loadout);
+	buffer.write(equipped);
+
+	auto abilities = std::uint32_t{};
+	for (auto i{0}; i < num_abilities; ++i) {
+		if (player.catalog.categories.abilities.has_ability(static_cast<player::Abilities>(i))) { abilities |= 1u << i; }
+	}
+	buffer.write(abilities);
+
+	auto items = std::vector<sf::Vector2<int>>{};
+	for (auto& item : player.catalog.categories.inventory.items) { items.push_back({item.get_id(), item.get_quantity()}); }
+	buffer.write(items);
+
+	buffer.write(player.tutorial.flags);
+	buffer.write(player.tutorial.helpers);
+	buffer.write(player.tutorial.current_state);
+
+	buffer.write(svc.stats);
+	buffer.write(svc.random);
+}
+
+void WorldSnapshot::restore(automa::ServiceProvider& svc, player::Player& player) {
+	if (empty()) { return; }
+	buffer.rewind();
+
+	svc.data.read_progress(buffer);
+	buffer.read(svc.state_controller.save_point_id);
+
+	player.set_position(buffer.read<sf::Vector2<float>>());
+	player.health.set_max(buffer.read<float>());
+	player.health.set_hp(buffer.read<float>());
+	buffer.read(player.player_stats.orbs);
+
+	auto const loadout = buffer.read<std::vector<int>>();
+	auto const equipped = buffer.read<std::size_t>();
+	player.arsenal = {};
+	if (!loadout.empty()) { player.arsenal = arms::Arsenal(svc); }
+	for (auto const id : loadout) { player.arsenal.value().push_to_loadout(id); }
+	if (player.arsenal) { player.arsenal.value().set_index(static_cast<int>(equipped)); }
+
+	auto const abilities = buffer.read<std::uint32_t>();
+	player.catalog.categories.abilities.clear();
+	for (auto i{0}; i < num_abilities; ++i) {
+		if (abilities & (1u << i)) { player.catalog.categories.abilities.give_ability(static_cast<player::Abilities>(i)); }
+	}
+
+	auto const items = buffer.read<std::vector<sf::Vector2<int>>>();
+	player.catalog.categories.inventory.clear();
+	for (auto const& item : items) { player.catalog.categories.inventory.add_item(svc, item.x, item.y); }
+
+	buffer.read(player.tutorial.flags);
+	buffer.read(player.tutorial.helpers);
+	buffer.read(player.tutorial.current_state);
+
+	// read last, since rebuilding the inventory bumps the item counter. deaths keep counting across retries, like load_progress.
+	auto const deaths = svc.stats.player.death_count.get_count();
+	buffer.read(svc.stats);
+	svc.stats.player.death_count.set(deaths);
+	buffer.read(svc.random);
+}
+
+void WorldSnapshot::clear() {
+	buffer.clear();
+	room = -1;
+	file = -1;
+}
+
+} // namespace data
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include "../utils/ByteBuffer.hpp"
+
+namespace automa {
+struct ServiceProvider;
+}
+
+namespace player {
+class Player;
+}
+
+namespace data {
+
+// compact binary copy of the simulation state a save point or room entry pins down:
+// progress lists and quests, stats, the player's position, health, loadout, items and tutorial state, and the rng.
+// the room itself isn't serialised. its entities are rebuilt in place from the parsed room data (see Map::restore),
+// so restoring skips the save json, layer textures and minimap bakes entirely.
+class WorldSnapshot {
+  public:
+	void capture(automa::ServiceProvider& svc, player::Player& player, int room_id);
+	void restore(automa::ServiceProvider& svc, player::Player& player);
+	void clear();
+
+	[[nodiscard]] auto get_room() const -> int { return room; }
+	[[nodiscard]] auto get_file() const -> int { return file; }
+	[[nodiscard]] auto size() const -> std::size_t { return buffer.size(); }
+	[[nodiscard]] auto empty() const -> bool { return buffer.empty(); }
+
+  private:
+	util::ByteBuffer buffer{};
+	int room{-1};
+	int file{-1};
+};
+
+} // namespace data
@@ -0,0 +1,81 @@
+#include "BootReport.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <optional>
+
+namespace util {
+
+void BootReport::add(std::string name, Clk::time_point start, Clk::time_point finish) {
+	auto const time = Ms{finish - start};
+	stages.push_back({std::move(name), start, finish, time, {}, time, 1});
+}
+
+void BootReport::add(std::string name, std::span<Piece const> pieces) {
+	if (pieces.empty()) { return; }
+	auto& stage = stages.emplace_back();
+	stage.name = std::move(name);
+	stage.start = pieces.front().start;
+	stage.finish = pieces.front().finish;
+	stage.pieces = pieces.size();
+	for (auto const& piece : pieces) {
+		auto const time = Ms{piece.finish - piece.start};
+		stage.start = std::min(stage.start, piece.start);
+		stage.finish = std::max(stage.finish, piece.finish);
+		stage.work += time;
+		if (time >= stage.slowest_time) {
+			stage.slowest_time = time;
+			stage.slowest = piece.label;
+		}
+	}
+}
+
+auto BootReport::critical_path() const -> std::vector<std::size_t> {
+	auto ret = std::vector<std::size_t>{};
+	if (stages.empty()) { return ret; }
+	auto by_finish = [this](std::size_t a, std::size_t b) { return stages.at(a).finish < stages.at(b).finish; };
+	auto current = std::size_t{0};
+	for (std::size_t i{1}; i < stages.size(); ++i) {
+		if (by_finish(current, i)) { current = i; }
+	}
+	for (;;) {
+		ret.push_back(current);
+		auto previous = std::optional<std::size_t>{};
+		for (std::size_t i{0}; i < stages.size(); ++i) {
+			if (i == current || stages.at(i).finish > stages.at(current).start) { continue; }
+			if (!previous || by_finish(*previous, i)) { previous = i; }
+		}
+		if (!previous) { break; }
+		current = *previous;
+	}
+	std::reverse(ret.begin(), ret.end());
+	return ret;
+}
+
+auto BootReport::elapsed() const -> Ms {
+	auto finish = origin;
+	for (auto const& stage : stages) { finish = std::max(finish, stage.finish); }
+	return finish - origin;
+}
+
+void BootReport::print(std::ostream& out) const {
+	auto const flags = out.flags();
+	auto const precision = out.precision();
+	out << std::fixed << std::setprecision(1);
+	out << "> boot took " << elapsed().count() << "ms on " << threads << " threads\n";
+	for (auto const& stage : stages) {
+		out << "  " << std::left << std::setw(16) << stage.name << std::right << std::setw(8) << Ms{stage.start - origin}.count() << " -> " << std::setw(8) << Ms{stage.finish - origin}.count() << "ms";
+		if (stage.pieces > 1) { out << "  (" << stage.pieces << " files, " << stage.work.count() << "ms of work, slowest " << stage.slowest << " " << stage.slowest_time.count() << "ms)"; }
+		out << "\n";
+	}
+	out << "> critical path:";
+	auto first{true};
+	for (auto const i : critical_path()) {
+		out << (first ? " " : " -> ") << stages.at(i).name << " " << Ms{stages.at(i).finish - stages.at(i).start}.count() << "ms";
+		first = false;
+	}
+	out << "\n";
+	out.flags(flags);
+	out.precision(precision);
+}
+
+} // namespace util
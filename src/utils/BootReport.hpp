@@ -0,0 +1,59 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace util {
+
+// where startup spent its time. stages are recorded as they finish and printed with the chain of stages that decided
+// when boot was done: each link is whichever stage finished last before the next one began.
+class BootReport {
+  public:
+	using Clk = std::chrono::steady_clock;
+	using Ms = std::chrono::duration<float, std::milli>;
+
+	// one unit of work in a stage that is spread over several threads
+	struct Piece {
+		std::string_view label{};
+		Clk::time_point start{};
+		Clk::time_point finish{};
+	};
+
+	void add(std::string name, Clk::time_point start, Clk::time_point finish);
+	// the stage spans its earliest and latest piece. its slowest piece bounds it however many threads share the rest.
+	void add(std::string name, std::span<Piece const> pieces);
+	template <typename F>
+	void measure(std::string name, F&& fn) {
+		auto const start = Clk::now();
+		fn();
+		add(std::move(name), start, Clk::now());
+	}
+
+	// stage indices, first to last
+	[[nodiscard]] auto critical_path() const -> std::vector<std::size_t>;
+	[[nodiscard]] auto elapsed() const -> Ms;
+	void print(std::ostream& out) const;
+
+	std::size_t threads{1};
+
+  private:
+	struct Stage {
+		std::string name{};
+		Clk::time_point start{};
+		Clk::time_point finish{};
+		Ms work{}; // summed over every thread that took part
+		std::string slowest{};
+		Ms slowest_time{};
+		std::size_t pieces{};
+	};
+
+	Clk::time_point origin{Clk::now()};
+	std::vector<Stage> stages{};
+};
+
+} // namespace util
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace util {
+
+// growable byte buffer for compact in-memory snapshots. values are read back in the order they were written.
+// only trivially copyable values, strings and vectors of either are supported; nothing is versioned or portable.
+class ByteBuffer {
+  public:
+	template <typename T>
+	void write(T const& value) {
+		static_assert(std::is_trivially_copyable_v<T>, "ByteBuffer can only copy trivially copyable types");
+		auto const* first = reinterpret_cast<std::byte const*>(&value);
+		bytes.insert(bytes.end(), first, first + sizeof(T));
+	}
+	void write(std::string const& value) {
+		write(value.size());
+		auto const* first = reinterpret_cast<std::byte const*>(value.data());
+		bytes.insert(bytes.end(), first, first + value.size());
+	}
+	template <typename T>
+	void write(std::vector<T> const& values) {
+		write(values.size());
+		for (auto const& value : values) { write(value); }
+	}
+
+	template <typename T>
+	void read(T& value) {
+		static_assert(std::is_trivially_copyable_v<T>, "ByteBuffer can only copy trivially copyable types");
+		std::memcpy(&value, take(sizeof(T)), sizeof(T));
+	}
+	void read(std::string& value) {
+		auto const size = read<std::size_t>();
+		auto const* first = take(size);
+		value.assign(reinterpret_cast<char const*>(first), size);
+	}
+	template <typename T>
+	void read(std::vector<T>& values) {
+		values.resize(read<std::size_t>());
+		for (auto& value : values) { read(value); }
+	}
+	template <typename T>
+	[[nodiscard]] auto read() -> T {
+		auto value = T{};
+		read(value);
+		return value;
+	}
+
+	void rewind() { cursor = 0; }
+	void clear() {
+		bytes.clear();
+		cursor = 0;
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t { return bytes.size(); }
+	[[nodiscard]] auto empty() const -> bool { return bytes.empty(); }
+
+  private:
+	auto take(std::size_t count) -> std::byte const* {
+		if (count > bytes.size() - cursor) { throw std::out_of_range("ByteBuffer read past the end"); }
+		auto const* first = bytes.data() + cursor;
+		cursor += count;
+		return first;
+	}
+
+	std::vector<std::byte> bytes{};
+	std::size_t cursor{};
+};
+
+} // namespace util
@@ -82,18 +82,14 @@ void Collider::handle_map_collision(world::Tile const& tile) {
 		return;
 	}
 
-	// store all four mtvs
-	mtvs.combined = predictive_combined.testCollisionGetMTV(predictive_combined, cell);
-	mtvs.vertical = predictive_vertical.testCollisionGetMTV(predictive_vertical, cell);
-	mtvs.horizontal = predictive_horizontal.testCollisionGetMTV(predictive_horizontal, cell);
-	mtvs.actual = bounding_box.testCollisionGetMTV(bounding_box, cell);
+	probe(cell);
 
 	float vert_threshold = 5.5f; // for landing
 	// let's first settle all actual block collisions
 	if (!is_ramp) {
 		if (collision_depths) { collision_depths.value().calculate(*this, cell); }
 		bool corner_collision{true};
-		if (predictive_vertical.SAT(cell)) {
+		if (contacts.vertical) {
 			mtvs.vertical.y < 0.f ? flags.collision.set(Collision::has_bottom_collision) : flags.collision.set(Collision::has_top_collision);
 			//if (abs(mtvs.combined.x > 0.0001f)) { std::cout << "Combined MTV reading: " << mtvs.combined.x << "\n"; }
 			if (flags.collision.test(Collision::has_bottom_collision) && physics.velocity.y > vert_threshold) {
@@ -105,7 +101,7 @@ void Collider::handle_map_collision(world::Tile const& tile) {
 			flags.external_state.set(ExternalState::vert_world_collision);
 			correct_y(mtvs.vertical);
 		}
-		if (predictive_horizontal.SAT(cell) && !tile.ramp_adjacent()) {
+		if (contacts.horizontal && !tile.ramp_adjacent()) {
 			mtvs.horizontal.x > 0.f ? flags.collision.set(Collision::has_left_collision) : flags.collision.set(Collision::has_right_collision);
 			corner_collision = false;
 			flags.dash.set(Dash::dash_cancel_collision);
@@ -114,7 +110,7 @@ void Collider::handle_map_collision(world::Tile const& tile) {
 			flags.external_state.reset(ExternalState::vert_world_collision);
 			correct_x(mtvs.horizontal);
 		}
-		if (predictive_combined.SAT(cell) && corner_collision && !tile.ramp_adjacent()) {
+		if (contacts.combined && corner_collision && !tile.ramp_adjacent()) {
 			//if (abs(mtvs.combined.x > 0.0001f)) { std::cout << "Combined MTV reading: " << mtvs.combined.x << "\n"; }
 			flags.collision.set(Collision::any_collision);
 			flags.dash.set(Dash::dash_cancel_collision);
@@ -131,7 +127,7 @@ void Collider::handle_map_collision(world::Tile const& tile) {
 		bool jumps_into = physics.velocity.y < vert_threshold;
 		// ground ramp
 		// only handle ramp collisions if the bounding_box is colliding with it
-		if (bounding_box.SAT(cell)) {
+		if (contacts.actual) {
 			if (is_ground_ramp && !flags.general.test(General::ignore_resolution)) {
 				if (mtvs.actual.y < 0.f) { physics.position.y += mtvs.actual.y; }
 				// still zero this because of gravity
@@ -145,7 +141,7 @@ void Collider::handle_map_collision(world::Tile const& tile) {
 			flags.external_state.set(ExternalState::world_collision);
 		}
 		// we also need to check if the predictive bounding box is colliding a ramp, just to deal with falling/jumping onto and into ramps
-		if (predictive_combined.SAT(cell)) {
+		if (contacts.combined) {
 			if (falls_onto) {
 				correct_corner(mtvs.combined);
 				flags.state.set(State::just_landed);
@@ -197,63 +193,92 @@ void Collider::handle_map_collision(world::Tile const& tile) {
 	sync_components();
 }
 
+// one pass per probe yields both the mtv and the overlap test for every predictive box
+void Collider::probe(Shape const& other) {
+	auto const combined = predictive_combined.get_contact(other);
+	auto const vertical = predictive_vertical.get_contact(other);
+	auto const horizontal = predictive_horizontal.get_contact(other);
+	auto const actual = bounding_box.get_contact(other);
+	mtvs = {combined.mtv, horizontal.mtv, vertical.mtv, actual.mtv};
+	contacts = {combined.overlapping, horizontal.overlapping, vertical.overlapping, actual.overlapping};
+}
+
 void Collider::detect_map_collision(world::Map& map) {
 	flags.external_state.reset(ExternalState::grounded);
 	flags.perma_state = {};
-	for (auto& index : map.collidable_indeces) {
-		auto& cell = map.get_layers().at(world::MIDDLEGROUND).grid.cells.at(index);
-		cell.collision_check = false;
-		if (!map.nearby(cell.bounding_box, bounding_box)) {
-			continue;
-		} else {
-			// check vicinity so we can escape early
-			if (vicinity.vertices.empty()) { return; }
-			if (!vicinity.overlaps(cell.bounding_box)) {
-				continue;
-			} else {
-				cell.collision_check = true;
-				if (cell.value > 0) { handle_map_collision(cell); }
-			}
-		}
-	}
+	// check vicinity so we can escape early
+	if (vicinity.vertices.empty()) { return; }
+	sweep_map(map);
+	map.for_each_collidable_cell(vicinity, [this, &map](world::Tile& cell) {
+		auto const marks = !flags.general.test(General::unmarked);
+		if (marks) { cell.collision_check = false; }
+		// nearby() measures from a tile's corner, which says nothing for a long merged block
+		if (!cell.is_merged() && !map.nearby(cell.bounding_box, bounding_box)) { return; }
+		if (!vicinity.overlaps(cell.bounding_box)) { return; }
+		if (marks) { cell.collision_check = true; }
+		if (cell.value > 0) { handle_map_collision(cell); }
+	});
+}
+
+// continuous collision for fast movers. the collider is moved back to where it first touched solid ground along this tick's
+// displacement, and the discrete resolution then handles the contact as usual. slow colliders are never swept.
+void Collider::sweep_map(world::Map& map) {
+	if (flags.general.test(General::ignore_resolution) || !moving_fast()) { return; }
+	auto const displacement = physics.apparent_velocity();
+	auto first_contact = std::optional<float>{};
+	map.get_layers().at(world::MIDDLEGROUND).grid.for_each_cell_along(bounding_box, displacement, [this, displacement, &first_contact](world::Tile& cell) {
+		if (!cell.is_collision_candidate() || !cell.is_solid()) { return; }
+		auto contact = bounding_box.sweep(displacement, cell.bounding_box);
+		// contacts at zero were already touching last tick and are left to the discrete resolution
+		if (contact && contact.value() > 0.f && (!first_contact || contact.value() < first_contact.value())) { first_contact = contact; }
+	});
+	if (first_contact) { rewind(first_contact.value()); }
+}
+
+void Collider::sweep_collider(Shape const& collider) {
+	if (!moving_fast()) { return; }
+	auto contact = bounding_box.sweep(physics.apparent_velocity(), collider);
+	if (contact && contact.value() > 0.f) { rewind(contact.value()); }
+}
+
+void Collider::rewind(float fraction) {
+	physics.position = physics.previous_position + physics.apparent_velocity() * fraction;
+	sync_components();
+}
+
+// a body that stays on the ground without moving for long enough falls asleep.
+// owners skip its simulation while asleep and call wake() once something could move it again.
+void Collider::settle() {
+	auto const movement = physics.apparent_velocity();
+	auto const resting = world_grounded() && std::abs(movement.x) < rest_threshold && std::abs(movement.y) < rest_threshold;
+	rest_ticks = resting ? std::min(rest_ticks + 1, ticks_to_sleep) : 0;
+	if (asleep()) { physics.previous_position = physics.position; } // sleepers aren't integrated, so hold the sprite still
+}
+
+void Collider::set_position(sf::Vector2<float> position) {
+	physics.position = position;
+	physics.previous_position = position;
+	sync_components();
 }
 
 int Collider::detect_ledge_height(world::Map& map) {
-	int ret{};
-	auto total = map.get_layers().at(world::MIDDLEGROUND).grid.cells.size();
-	for (int index = 0; index < total; ++index) {
-		auto& cell = map.get_layers().at(world::MIDDLEGROUND).grid.cells.at(index);
-		if (!map.nearby(cell.bounding_box, bounding_box)) {
-			continue;
-		} else {
-			// check vicinity so we can escape early
-			if (vicinity.vertices.empty()) { return ret; }
-			if (!vicinity.overlaps(cell.bounding_box)) {
-				continue;
-			} else {
-				// we're in the vicinity now, so we check the bottom left and right corners to find a potential ledge
-				if (!cell.is_occupied()) {
-					auto right = cell.bounding_box.contains_point(vicinity.vertices.at(2));
-					auto left = cell.bounding_box.contains_point(vicinity.vertices.at(3));
-					if (left) { flags.state.set(State::ledge_left); }
-					if (right) { flags.state.set(State::ledge_right); }
-						if (left || right) { // left ledge found
-						bool found{};
-						auto next_row = index + map.dimensions.x;
-						while (!found) {
-							if (map.get_layers().at(world::MIDDLEGROUND).grid.cells.size() <= next_row) { return map.dimensions.y; };
-							if (map.get_layers().at(world::MIDDLEGROUND).grid.cells.at(next_row).is_occupied()) { found = true; }
-							next_row += map.dimensions.x;
-							++ret;
-							if (ret > (int)map.dimensions.y) { return map.dimensions.y; }
-						}
-						return ret;
-					}
-				}
-			}
-		}
-	}
-	return ret;
+	if (vicinity.vertices.empty()) { return 0; }
+	auto& grid = map.get_layers().at(world::MIDDLEGROUND).grid;
+	// check the bottom left and right corners of the vicinity to find a potential ledge. left goes first, as it comes first in the grid.
+	// a ledge is an empty cell, so it has no tile in the grid's side table and gets a stand-in box
+	auto cell_box = Shape(sf::Vector2<float>{lookup::unit_size_f, lookup::unit_size_f});
+	auto check_corner = [this, &map, &grid, &cell_box](sf::Vector2<float> corner, State ledge) -> std::optional<int> {
+		auto const index = grid.get_index(corner);
+		if (!index) { return {}; }
+		if (auto const* cell = grid.find(*index); cell && cell->is_occupied()) { return {}; }
+		cell_box.set_position(grid.get_position(*index));
+		if (!map.nearby(cell_box, bounding_box)) { return {}; }
+		flags.state.set(ledge);
+		return grid.get_drop_height(*index);
+	};
+	if (auto height = check_corner(vicinity.vertices.at(3), State::ledge_left)) { return height.value(); }
+	if (auto height = check_corner(vicinity.vertices.at(2), State::ledge_right)) { return height.value(); }
+	return 0;
 }
 
 void Collider::correct_x(sf::Vector2<float> mtv) {
@@ -327,6 +352,7 @@ void Collider::handle_spike_collision(Shape const& cell) {
 
 void Collider::handle_collider_collision(Shape const& collider) {
 	if (flags.general.test(General::ignore_resolution)) { return; }
+	sweep_collider(collider);
 	if (!vicinity.overlaps(collider)) { return; }
 	if (collision_depths) {
 		if (collision_depths.value().crushed()) { return; }
@@ -334,17 +360,13 @@ void Collider::handle_collider_collision(Shape const& collider) {
 
 	flags.collision = {};
 
-	// store all four mtvs
-	mtvs.combined = predictive_combined.testCollisionGetMTV(predictive_combined, collider);
-	mtvs.vertical = predictive_vertical.testCollisionGetMTV(predictive_vertical, collider);
-	mtvs.horizontal = predictive_horizontal.testCollisionGetMTV(predictive_horizontal, collider);
-	mtvs.actual = bounding_box.testCollisionGetMTV(bounding_box, collider);
+	probe(collider);
 
 	float vert_threshold = 5.5f;
 	if (collision_depths) { collision_depths.value().calculate(*this, collider); }
 
 	bool corner_collision{true};
-	if (predictive_vertical.SAT(collider)) {
+	if (contacts.vertical) {
 		mtvs.vertical.y < 0.f ? flags.collision.set(Collision::has_bottom_collision) : flags.collision.set(Collision::has_top_collision);
 		//if (abs(mtvs.vertical.y > 0.001f)) { std::cout << "Vertical MTV reading: " << mtvs.vertical.y << "\n"; }
 		if (flags.collision.test(Collision::has_bottom_collision) && physics.velocity.y > vert_threshold) {
@@ -362,7 +384,7 @@ void Collider::handle_collider_collision(Shape const& collider) {
 		}
 		if (flags.collision.test(Collision::has_top_collision)) { flags.external_state.set(ExternalState::jumped_into); }
 	}
-	if (predictive_horizontal.SAT(collider)) {
+	if (contacts.horizontal) {
 		mtvs.horizontal.x > 0.f ? flags.collision.set(Collision::has_left_collision) : flags.collision.set(Collision::has_right_collision);
 		corner_collision = false;
 		flags.dash.set(Dash::dash_cancel_collision);
@@ -394,14 +416,13 @@ void Collider::handle_collider_collision(Shape const& collider) {
 void Collider::update(automa::ServiceProvider& svc) {
 	flags.external_state = {};
 	physics.update(svc);
-	position_history.push_back(physics.position);
 	sync_components();
 	flags.state.reset(State::just_collided);
 	physics.gravity = flags.state.test(State::grounded) ? 0.0f : stats.GRAV;
 	flags.state.test(State::grounded) ? physics.flags.set(components::State::grounded) : physics.flags.reset(components::State::grounded);
 }
 
-void Collider::render(sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Collider::render(flfx::DrawList& win, sf::Vector2<float> cam) {
 
 	// draw predictive vertical
 	box.setSize(predictive_vertical.dimensions);
@@ -514,15 +535,8 @@ bool Collider::pushes(Collider& other) const {
 	return (physics.position.x < other.physics.position.x && physics.velocity.x > 0.f) || (physics.position.x > other.physics.position.x && physics.velocity.x < 0.f);
 }
 
-sf::Vector2<float> Collider::get_average_tick_position() {
-	sf::Vector2<float> ret{};
-	auto size = static_cast<int>(position_history.size());
-	if (size == 0) { return physics.position; }
-	for (auto& pos : position_history) { ret += pos; }
-	ret.x /= size;
-	ret.y /= size;
-	return ret;
-}
+// blends the position from the start of the last tick with the current one. alpha is how far the renderer is between ticks, from 0 to 1.
+sf::Vector2<float> Collider::get_interpolated_position(float alpha) const { return physics.previous_position + (physics.position - physics.previous_position) * alpha; }
 
 sf::Vector2<float> Collider::snap_to_grid(float size, float scale, float factor) {
 	return sf::Vector2<float>{std::round((physics.position.x * size / factor) / (size * (scale / factor))), std::round((physics.position.y * size / factor) / (size * (scale / factor)))} *
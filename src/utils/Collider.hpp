@@ -7,6 +7,7 @@
 #include "Shape.hpp"
 #include "CollisionDepth.hpp"
 #include <optional>
+#include "../graphics/DrawList.hpp"
 
 namespace world{
 class Map;
@@ -22,7 +23,7 @@ float const default_jumpbox_height = 4.0f;
 float const default_detector_width = 4.f;
 float const default_detector_height = 18.f;
 
-enum class General { ignore_resolution, complex, pushable, soft };
+enum class General { ignore_resolution, complex, pushable, soft, unmarked };
 enum class Animation { just_landed };
 enum class State { just_collided, is_any_jump_collision, is_any_collision, just_landed, ceiling_collision, grounded, world_grounded, on_ramp, ledge_left, ledge_right, left_wallslide_collision, right_wallslide_collision };
 enum class ExternalState { grounded, collider_collision, vert_collider_collision, horiz_collider_collision, world_collision, horiz_world_collision, vert_world_collision, world_grounded, jumped_into };
@@ -61,8 +62,16 @@ class Collider {
 	void handle_platform_collision(Shape const& cell);
 	void handle_spike_collision(Shape const& cell);
 	void handle_collider_collision(Shape const& collider);
+	void probe(Shape const& other);
+	void sweep_map(world::Map& map);
+	void sweep_collider(Shape const& collider);
+	void rewind(float fraction);
+	void settle();
+	void wake() { rest_ticks = 0; }
+	// moves the body without interpolating from where it was, for spawns and teleports
+	void set_position(sf::Vector2<float> position);
 	void update(automa::ServiceProvider& svc);
-	void render(sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(flfx::DrawList& win, sf::Vector2<float> cam);
 	void reset();
 	void reset_ground_flags();
 
@@ -78,8 +87,7 @@ class Collider {
 	bool vertical_squish() const;
 	bool pushes(Collider& other) const;
 
-	void flush_positions() { position_history.clear(); }
-	sf::Vector2<float> get_average_tick_position();
+	sf::Vector2<float> get_interpolated_position(float alpha) const;
 	sf::Vector2<float> snap_to_grid(float size = 1.f, float scale = 32.f, float factor = 2.f);
 
 	[[nodiscard]] auto grounded() const -> bool { return flags.external_state.test(ExternalState::grounded); }
@@ -94,6 +102,8 @@ class Collider {
 	[[nodiscard]] auto right() const -> float { return bounding_box.right(); }
 	[[nodiscard]] auto top() const -> float { return bounding_box.top(); }
 	[[nodiscard]] auto bottom() const -> float { return bounding_box.bottom(); }
+	[[nodiscard]] auto asleep() const -> bool { return rest_ticks >= ticks_to_sleep; }
+	[[nodiscard]] auto moving_fast() const -> bool { return std::abs(physics.apparent_velocity().x) > dimensions.x * continuous_threshold || std::abs(physics.apparent_velocity().y) > dimensions.y * continuous_threshold; }
 
 	float compute_length(sf::Vector2<float> const v);
 
@@ -131,6 +141,13 @@ class Collider {
 		sf::Vector2<float> actual{};
 	} mtvs{};
 
+	struct {
+		bool combined{};
+		bool horizontal{};
+		bool vertical{};
+		bool actual{};
+	} contacts{};
+
 	struct {
 		sf::Color local{};
 	} colors{};
@@ -139,11 +156,14 @@ class Collider {
 	float horizontal_detector_buffer{1.0f};
 	float vertical_detector_buffer{1.0f};
 	float depth_buffer{1.0f};
+	float continuous_threshold{0.5f}; // fraction of the collider's size it may move in one tick before its motion is swept
+	float rest_threshold{0.01f};	  // largest per-tick movement that still counts as resting
+	int rest_ticks{};				  // consecutive ticks spent resting on the ground
+	static constexpr int ticks_to_sleep{128};
 
 	sf::Vector2<float> dimensions{};
 	sf::Vector2<float> sprite_offset{};
 	sf::Vector2<float> hurtbox_offset{};
-	std::deque<sf::Vector2<float>> position_history{};
 
 
 	bool spike_trigger{};
@@ -59,7 +59,7 @@ void CollisionDepth::print() {
 	}
 }
 
-void CollisionDepth::render(shape::Shape const& bounding_box, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void CollisionDepth::render(shape::Shape const& bounding_box, flfx::DrawList& win, sf::Vector2<float> cam) {
 	collision_ray.setFillColor(sf::Color::Cyan);
 
 	// left
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace util {
+
+// 64 bit fnv-1a. fast and good enough to tell files apart, not for anything an attacker controls.
+[[nodiscard]] constexpr auto get_hash(std::string_view bytes) -> std::uint64_t {
+	auto ret = std::uint64_t{14695981039346656037ull};
+	for (auto const c : bytes) {
+		ret ^= static_cast<unsigned char>(c);
+		ret *= 1099511628211ull;
+	}
+	return ret;
+}
+
+} // namespace util
@@ -0,0 +1,62 @@
+#include "JobSystem.hpp"
+
+namespace util {
+
+JobSystem::JobSystem(std::size_t num_workers) {
+	for (std::size_t i{0}; i <= num_workers; ++i) { queues.push_back(std::make_unique<Queue>()); }
+	for (std::size_t i{0}; i < num_workers; ++i) {
+		workers.emplace_back([this, i] { work(i); });
+	}
+}
+
+JobSystem::~JobSystem() {
+	{
+		auto lock = std::lock_guard{sleep_mutex};
+		stopping = true;
+	}
+	wake.notify_all();
+	for (auto& worker : workers) { worker.join(); }
+}
+
+void JobSystem::push(std::size_t queue, Job job) {
+	auto& target = *queues.at(queue);
+	auto lock = std::lock_guard{target.mutex};
+	target.jobs.push_back(std::move(job));
+	pending.fetch_add(1, std::memory_order_release);
+}
+
+void JobSystem::wake_workers() {
+	// taking the lock orders this against a worker that is about to sleep, so the wakeup can't be missed
+	{ auto lock = std::lock_guard{sleep_mutex}; }
+	wake.notify_all();
+}
+
+bool JobSystem::run_one(std::size_t home) {
+	auto job = Job{};
+	for (std::size_t offset{0}; offset < queues.size() && !job; ++offset) {
+		auto& queue = *queues.at((home + offset) % queues.size());
+		auto lock = std::lock_guard{queue.mutex};
+		if (queue.jobs.empty()) { continue; }
+		if (offset == 0) {
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+		} else {
+			job = std::move(queue.jobs.back());
+			queue.jobs.pop_back();
+		}
+	}
+	if (!job) { return false; }
+	pending.fetch_sub(1, std::memory_order_acq_rel);
+	job();
+	return true;
+}
+
+void JobSystem::work(std::size_t index) {
+	while (!stopping) {
+		if (run_one(index)) { continue; }
+		auto lock = std::unique_lock{sleep_mutex};
+		wake.wait(lock, [this] { return stopping || pending.load(std::memory_order_acquire) > 0; });
+	}
+}
+
+} // namespace util
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace util {
+
+// small work-stealing thread pool. each thread owns a queue, takes work from its front and steals from the back of the others.
+// the calling thread takes part in its own parallel_for, so the pool never blocks waiting on itself.
+class JobSystem {
+  public:
+	explicit JobSystem(std::size_t num_workers = default_workers());
+	~JobSystem();
+	JobSystem(JobSystem const&) = delete;
+	JobSystem& operator=(JobSystem const&) = delete;
+
+	// calls fn(i) for every i in [0, count) and returns once all calls are done.
+	// fn must only write to state owned by index i. small ranges run inline on the caller.
+	template <typename F>
+	void parallel_for(std::size_t count, F&& fn, std::size_t grain = 8) {
+		if (count == 0) { return; }
+		grain = std::max(grain, std::size_t{1});
+		if (workers.empty() || count <= grain) {
+			for (std::size_t i{0}; i < count; ++i) { fn(i); }
+			return;
+		}
+		auto const chunks = (count + grain - 1) / grain;
+		auto remaining = std::atomic<std::size_t>{chunks};
+		for (std::size_t chunk{0}; chunk < chunks; ++chunk) {
+			push(chunk % queues.size(), [&fn, &remaining, chunk, grain, count] {
+				auto const end = std::min(count, (chunk + 1) * grain);
+				for (auto i{chunk * grain}; i < end; ++i) { fn(i); }
+				remaining.fetch_sub(1, std::memory_order_acq_rel);
+			});
+		}
+		wake_workers();
+		while (remaining.load(std::memory_order_acquire) > 0) {
+			if (!run_one(caller_queue())) { std::this_thread::yield(); }
+		}
+	}
+
+	[[nodiscard]] auto size() const -> std::size_t { return workers.size() + 1; }
+	[[nodiscard]] static auto default_workers() -> std::size_t { return std::max(std::thread::hardware_concurrency(), 2u) - 1; }
+
+  private:
+	using Job = std::function<void()>;
+	struct Queue {
+		std::mutex mutex{};
+		std::deque<Job> jobs{};
+	};
+
+	void push(std::size_t queue, Job job);
+	void wake_workers();
+	bool run_one(std::size_t home);
+	void work(std::size_t index);
+	[[nodiscard]] auto caller_queue() const -> std::size_t { return workers.size(); }
+
+	std::vector<std::unique_ptr<Queue>> queues{}; // one per worker, plus one for the caller
+	std::vector<std::thread> workers{};
+	std::mutex sleep_mutex{};
+	std::condition_variable wake{};
+	std::atomic<std::size_t> pending{};
+	std::atomic<bool> stopping{};
+};
+
+} // namespace util
@@ -0,0 +1,73 @@
+#include "MappedFile.hpp"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace util {
+
+#if defined(_WIN32)
+
+bool MappedFile::open(std::filesystem::path const& path) {
+	close();
+	auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) { return false; }
+	auto length = LARGE_INTEGER{};
+	if (!GetFileSizeEx(file, &length) || length.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+	// the view keeps the mapping alive, so neither handle is needed once it exists
+	auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (!mapping) { return false; }
+	auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!view) { return false; }
+	data = static_cast<std::byte const*>(view);
+	size = static_cast<std::size_t>(length.QuadPart);
+	return true;
+}
+
+void MappedFile::close() {
+	if (data) { UnmapViewOfFile(data); }
+	data = nullptr;
+	size = 0;
+}
+
+#else
+
+bool MappedFile::open(std::filesystem::path const& path) {
+	close();
+	auto file = ::open(path.c_str(), O_RDONLY);
+	if (file < 0) { return false; }
+	struct stat info {};
+	if (fstat(file, &info) != 0 || info.st_size <= 0) {
+		::close(file);
+		return false;
+	}
+	// the mapping outlives the descriptor
+	auto* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file);
+	if (view == MAP_FAILED) { return false; }
+	data = static_cast<std::byte const*>(view);
+	size = static_cast<std::size_t>(info.st_size);
+	return true;
+}
+
+void MappedFile::close() {
+	if (data) { munmap(const_cast<std::byte*>(data), size); }
+	data = nullptr;
+	size = 0;
+}
+
+#endif
+
+} // namespace util
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+namespace util {
+
+// read-only view of a whole file mapped into memory. pages are only read from disk when touched,
+// and the view stays valid until the file is closed or the object dies.
+class MappedFile {
+  public:
+	MappedFile() = default;
+	explicit MappedFile(std::filesystem::path const& path) { open(path); }
+	~MappedFile() { close(); }
+	MappedFile(MappedFile const&) = delete;
+	MappedFile& operator=(MappedFile const&) = delete;
+	MappedFile(MappedFile&& other) noexcept : data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)) {}
+	MappedFile& operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			close();
+			data = std::exchange(other.data, nullptr);
+			size = std::exchange(other.size, 0);
+		}
+		return *this;
+	}
+
+	// returns false and maps nothing if the file is missing or empty
+	bool open(std::filesystem::path const& path);
+	void close();
+
+	[[nodiscard]] auto bytes() const -> std::span<std::byte const> { return {data, size}; }
+	[[nodiscard]] auto is_open() const -> bool { return data != nullptr; }
+
+  private:
+	std::byte const* data{};
+	std::size_t size{};
+};
+
+} // namespace util
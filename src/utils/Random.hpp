@@ -2,18 +2,56 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <memory>
+#include <numbers>
 #include <random>
+#include <span>
 
 namespace util {
 
-class Random {
-
+// xoshiro256** with the distribution helpers the game needs. every helper draws straight from next(),
+// so no distribution objects are built per call. not thread safe; each thread or subsystem should own a stream.
+class RandomStream {
   public:
-	int random_range(int lo, int hi) { return std::uniform_int_distribution<int>{lo, hi}(engine); }
+	explicit RandomStream(std::uint64_t value = 0) { seed(value); }
+
+	// splitmix64 spreads the seed over the whole state, so neighbouring seeds give unrelated sequences
+	void seed(std::uint64_t value) {
+		for (auto& word : state) {
+			value += 0x9e3779b97f4a7c15;
+			auto z = value;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+			word = z ^ (z >> 31);
+		}
+	}
+
+	std::uint64_t next() {
+		auto const result = rotl(state[1] * 5, 7) * 9;
+		auto const t = state[1] << 17;
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+		return result;
+	}
 
-	float random_range_float(float lo, float hi) { return std::uniform_real_distribution<float>{lo, hi}(engine); }
+	// uniform in [0, 1)
+	float unit() { return static_cast<float>(next() >> 40) * 0x1.0p-24f; }
+
+	// inclusive on both ends, like std::uniform_int_distribution
+	int random_range(int lo, int hi) {
+		auto const span = static_cast<std::uint64_t>(static_cast<std::int64_t>(hi) - lo) + 1;
+		return static_cast<int>(lo + static_cast<std::int64_t>(((next() >> 32) * span) >> 32));
+	}
+
+	float random_range_float(float lo, float hi) { return lo + (hi - lo) * unit(); }
 
 	sf::Vector2<float> random_vector_float(float lo, float hi) {
 		auto randx = random_range_float(lo, hi);
@@ -21,25 +59,45 @@ class Random {
 		return {randx, randy};
 	}
 
-	int unsigned_coin_flip() {
-		auto result = std::uniform_real_distribution<float>{-1.0f, 1.0f}(engine);
-		return (result > 0.0f) ? 0 : 1;
-	}
+	int unsigned_coin_flip() { return static_cast<int>(next() >> 63); }
 
-	int signed_coin_flip() {
-		auto result = std::uniform_real_distribution<float>{-1.0f, 1.0f}(engine);
-		return (result > 0.0f) ? -1 : 1;
+	int signed_coin_flip() { return (next() >> 63) ? -1 : 1; }
+
+	// box-muller
+	float random_range_normal(float const mean, float const std_dev) {
+		auto const radius = std::sqrt(-2.f * std::log(1.f - unit()));
+		return mean + std_dev * radius * std::cos(2.f * std::numbers::pi_v<float> * unit());
 	}
 
-	float random_range_normal(float const mean, float const std_dev) { return std::normal_distribution<float>{mean, std_dev}(engine); }
+	bool percent_chance(float const percent) { return unit() * 100.f < percent; }
 
-	bool percent_chance(float const percent) {
-		auto result = std::uniform_real_distribution<float>{0.0f, 100.0f}(engine);
-		return result < percent;
+	// fills out with uniform values in [lo, hi), for bursts that need many samples at once
+	void fill(std::span<float> out, float lo, float hi) {
+		for (auto& value : out) { value = random_range_float(lo, hi); }
 	}
 
   private:
-	std::default_random_engine engine{std::random_device{}()};
+	static constexpr std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+	std::array<std::uint64_t, 4> state{};
+};
+
+// the gameplay stream, plus separate streams for cosmetic randomness.
+// all three are seeded together, but vfx and audio never draw from the gameplay stream,
+// so particles and pitch variation can change without shifting a recorded replay.
+class Random : public RandomStream {
+  public:
+	Random() : Random(std::random_device{}()) {}
+	explicit Random(std::uint64_t value) { seed(value); }
+
+	void seed(std::uint64_t value) {
+		RandomStream::seed(value);
+		vfx.seed(value ^ 0x76667800a5a5a5a5);
+		audio.seed(value ^ 0x617564695a5a5a5a);
+	}
+
+	RandomStream vfx{};
+	RandomStream audio{};
 };
 
-} // namespace util
\ No newline at end of file
+} // namespace util
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+namespace util {
+
+// fixed-capacity ring buffer stored inline. once full, every push overwrites the oldest element, so memory never grows.
+// elements are indexed from oldest (0) to newest (size() - 1).
+template <typename T, std::size_t N>
+class RingBuffer {
+  public:
+	constexpr void push(T const& value) {
+		storage[(head + count) % N] = value;
+		if (count < N) {
+			++count;
+		} else {
+			head = (head + 1) % N;
+		}
+	}
+	constexpr void clear() {
+		head = 0;
+		count = 0;
+	}
+
+	template <typename F>
+	constexpr void for_each(F&& fn) const {
+		for (std::size_t i{0}; i < count; ++i) { fn(storage[(head + i) % N]); }
+	}
+
+	[[nodiscard]] constexpr auto at(std::size_t index) const -> T const& { return index < count ? storage[(head + index) % N] : throw std::out_of_range("RingBuffer index out of range"); }
+	[[nodiscard]] constexpr auto front() const -> T const& { return at(0); }
+	[[nodiscard]] constexpr auto back() const -> T const& { return at(count - 1); }
+	[[nodiscard]] constexpr auto size() const -> std::size_t { return count; }
+	[[nodiscard]] constexpr auto empty() const -> bool { return count == 0; }
+	[[nodiscard]] static constexpr auto capacity() -> std::size_t { return N; }
+
+  private:
+	std::array<T, N> storage{};
+	std::size_t head{};
+	std::size_t count{};
+};
+
+} // namespace util
@@ -117,7 +117,7 @@ float Shape::dotProduct(const Vec a, const Vec b) { return a.x * b.x + a.y * b.y
 Shape::Vec Shape::getNormal(const Vec v) { return Vec(-v.y, v.x); }
 
 // Find minimum and maximum projections of each vertex on the axis
-Shape::Vec Shape::projectOnAxis(const std::vector<Vec> vertices, const Vec axis) {
+Shape::Vec Shape::projectOnAxis(Polygon const& vertices, const Vec axis) {
 	float min = std::numeric_limits<float>::infinity();
 	float max = -std::numeric_limits<float>::infinity();
 	for (auto& vertex : vertices) {
@@ -141,16 +141,16 @@ Shape::Vec Shape::getCenter(Shape const& shape) { return (Vec(shape.position.x +
 
 Shape::Vec Shape::getThisCenter() { return (Vec(position.x + dimensions.x / 2.f, position.y + dimensions.y / 2.f)); }
 
-std::vector<Shape::Vec> Shape::getVertices(Shape const& shape) { return shape.vertices; }
+Shape::Polygon const& Shape::getVertices(Shape const& shape) { return shape.vertices; }
 
-Shape::Vec Shape::getPerpendicularAxis(const std::vector<Vec> vertices, std::size_t index) {
+Shape::Vec Shape::getPerpendicularAxis(Polygon const& vertices, std::size_t index) {
 	assert(index >= 0 && index < 4); // rect has 4 possible axes
 	return getNormal(getNormalized(vertices.at(index)));
 }
 
 // axes for which we'll test stuff. Two for each box, because testing for parallel axes isn't needed
 
-std::array<Shape::Vec, 8> Shape::getPerpendicularAxes(const std::vector<Vec> vertices1, std::vector<Vec> const& vertices2) {
+std::array<Shape::Vec, 8> Shape::getPerpendicularAxes(Polygon const& vertices1, Polygon const& vertices2) {
 	std::array<Vec, 8> axes;
 
 	axes[0] = getPerpendicularAxis(vertices1, 0);
@@ -165,39 +165,45 @@ std::array<Shape::Vec, 8> Shape::getPerpendicularAxes(const std::vector<Vec> ver
 	return axes;
 }
 
-// Separating Axis Theorem (SAT) collision test
-// Minimum Translation Vector (MTV) is returned for the first Oriented Bounding Box (OBB)
-bool Shape::testCollision(Shape const& obb1, Shape const& obb2, Vec& mtv) {
-	std::vector<Vec> vertices1 = getVertices(obb1);
-	std::vector<Vec> vertices2 = getVertices(obb2);
-
-	std::array<Vec, 4> axes1;
-	std::array<Vec, 4> axes2;
-
-	axes1[0] = obb1.normals.at(0);
-	axes1[1] = obb1.normals.at(1);
-	axes1[2] = obb1.normals.at(2);
-	axes1[3] = obb1.normals.at(3);
-
-	axes2[0] = obb2.normals.at(0);
-	axes2[1] = obb2.normals.at(1);
-	axes2[2] = obb2.normals.at(2);
-	axes2[3] = obb2.normals.at(3);
-
-	for (auto& axis : axes1) {
-		Vec proj1 = projectOnAxis(vertices1, axis);
-		Vec proj2 = projectOnAxis(vertices2, axis);
-
-		float overlap = getOverlapLength(proj1, proj2);
-		if (overlap == 0.f) { // shapes are not overlapping
-			return false;
+// overlap of both shapes' projections on each of the eight candidate axes, first's normals first.
+// the loops run over the axes innermost, so they operate on contiguous float lanes the compiler packs into simd registers.
+// every projection is computed with the same operations as projectOnAxis, so results match the per-axis path exactly.
+static std::array<float, 8> get_overlaps(Shape const& first, Shape const& second) {
+	std::array<float, 8> axes_x{};
+	std::array<float, 8> axes_y{};
+	for (std::size_t i{0}; i < 4; ++i) {
+		axes_x[i] = first.normals.at(i).x;
+		axes_y[i] = first.normals.at(i).y;
+		axes_x[i + 4] = second.normals.at(i).x;
+		axes_y[i + 4] = second.normals.at(i).y;
+	}
+	auto project = [&axes_x, &axes_y](Shape::Polygon const& vertices, std::array<float, 8>& min, std::array<float, 8>& max) {
+		min.fill(std::numeric_limits<float>::infinity());
+		max.fill(-std::numeric_limits<float>::infinity());
+		for (auto const& vertex : vertices) {
+			for (std::size_t i{0}; i < 8; ++i) {
+				float projection = vertex.x * axes_x[i] + vertex.y * axes_y[i];
+				min[i] = projection < min[i] ? projection : min[i];
+				max[i] = projection > max[i] ? projection : max[i];
+			}
 		}
+	};
+	std::array<float, 8> min1, max1, min2, max2;
+	project(first.vertices, min1, max1);
+	project(second.vertices, min2, max2);
+
+	std::array<float, 8> overlaps{};
+	for (std::size_t i{0}; i < 8; ++i) {
+		bool overlapping = min1[i] <= max2[i] && max1[i] >= min2[i];
+		overlaps[i] = overlapping ? std::min(max1[i], max2[i]) - std::max(min1[i], min2[i]) : 0.f;
 	}
-	for (auto& axis : axes2) {
-		Vec proj1 = projectOnAxis(vertices1, axis);
-		Vec proj2 = projectOnAxis(vertices2, axis);
+	return overlaps;
+}
 
-		float overlap = getOverlapLength(proj1, proj2);
+// Separating Axis Theorem (SAT) collision test
+// Minimum Translation Vector (MTV) is returned for the first Oriented Bounding Box (OBB)
+bool Shape::testCollision(Shape const& obb1, Shape const& obb2, Vec& mtv) {
+	for (auto overlap : get_overlaps(obb1, obb2)) {
 		if (overlap == 0.f) { // shapes are not overlapping
 			return false;
 		}
@@ -205,62 +211,29 @@ bool Shape::testCollision(Shape const& obb1, Shape const& obb2, Vec& mtv) {
 	return true;
 }
 
-Shape::Vec Shape::testCollisionGetMTV(Shape const& obb1, Shape const& obb2) {
-	Vec t_mtv = Vec(0.0f, 0.0f);
-	std::vector<Vec> vertices1 = getVertices(obb1);
-	std::vector<Vec> vertices2 = getVertices(obb2);
-
-	std::array<Vec, 4> axes1;
-	std::array<Vec, 4> axes2;
-
-	axes1[0] = obb1.normals.at(0);
-	axes1[1] = obb1.normals.at(1);
-	axes1[2] = obb1.normals.at(2);
-	axes1[3] = obb1.normals.at(3);
-
-	axes2[0] = obb2.normals.at(0);
-	axes2[1] = obb2.normals.at(1);
-	axes2[2] = obb2.normals.at(2);
-	axes2[3] = obb2.normals.at(3);
-
-	// we need to find the minimal overlap and axis on which it happens
+// minimal overlap along the axis on which it happens, pointed from obb2 towards obb1
+static Shape::Vec get_mtv(Shape const& obb1, Shape const& obb2, std::array<float, 8> const& overlaps) {
+	Shape::Vec t_mtv = Shape::Vec(0.0f, 0.0f);
 	float minOverlap = std::numeric_limits<float>::infinity();
 
-	for (auto& axis : axes1) {
-		Vec proj1 = projectOnAxis(vertices1, axis);
-		Vec proj2 = projectOnAxis(vertices2, axis);
-
-		float overlap = getOverlapLength(proj1, proj2);
-		if (overlap < NORMAL_TOLERANCE) { // shapes are not overlapping
-			return Vec(0.0f, 0.0f);
-		} else {
-			if (overlap < minOverlap) {
-				minOverlap = overlap;
-				t_mtv.x = axis.x * minOverlap;
-				t_mtv.y = axis.y * minOverlap;
-			}
-		}
-	}
-	for (auto& axis : axes2) {
-		Vec proj1 = projectOnAxis(vertices1, axis);
-		Vec proj2 = projectOnAxis(vertices2, axis);
-
-		float overlap = getOverlapLength(proj1, proj2);
+	for (std::size_t i{0}; i < 8; ++i) {
+		auto overlap = overlaps[i];
 		if (overlap < NORMAL_TOLERANCE) { // shapes are not overlapping
-			return Vec(0.0f, 0.0f);
+			return Shape::Vec(0.0f, 0.0f);
 		} else {
 			if (overlap < minOverlap) {
+				auto const& axis = i < 4 ? obb1.normals[i] : obb2.normals[i - 4];
 				minOverlap = overlap;
 				t_mtv.x = axis.x * minOverlap;
 				t_mtv.y = axis.y * minOverlap;
-				// ideally we would do this only once for the minimal overlap
-				// but this is very cheap operation
 			}
 		}
 	}
 
 	// need to reverse MTV if center offset and overlap are not pointing in the same direction
-	bool notPointingInTheSameDirection = dotProduct(getCenter(obb1) - getCenter(obb2), t_mtv) < 0.0f;
+	auto center = [](Shape const& shape) { return Shape::Vec(shape.position.x + shape.dimensions.x / 2.f, shape.position.y + shape.dimensions.y / 2.f); };
+	auto offset = center(obb1) - center(obb2);
+	bool notPointingInTheSameDirection = offset.x * t_mtv.x + offset.y * t_mtv.y < 0.0f;
 	if (notPointingInTheSameDirection) {
 		t_mtv.x = -t_mtv.x;
 		t_mtv.y = -t_mtv.y;
@@ -268,58 +241,48 @@ Shape::Vec Shape::testCollisionGetMTV(Shape const& obb1, Shape const& obb2) {
 	return t_mtv;
 }
 
-bool Shape::SAT(Shape const& other) {
-	Vec t_mtv = Vec(0.0f, 0.0f);
-	std::vector<Vec> vertices1 = getVertices(*this);
-	std::vector<Vec> vertices2 = getVertices(other);
-
-	std::array<Vec, 4> axes1;
-	std::array<Vec, 4> axes2;
-
-	axes1[0] = this->normals.at(0);
-	axes1[1] = this->normals.at(1);
-	axes1[2] = this->normals.at(2);
-	axes1[3] = this->normals.at(3);
-
-	axes2[0] = other.normals.at(0);
-	axes2[1] = other.normals.at(1);
-	axes2[2] = other.normals.at(2);
-	axes2[3] = other.normals.at(3);
+Shape::Vec Shape::testCollisionGetMTV(Shape const& obb1, Shape const& obb2) { return get_mtv(obb1, obb2, get_overlaps(obb1, obb2)); }
 
-	// we need to find the minimal overlap and axis on which it happens
-	float minOverlap = std::numeric_limits<float>::infinity();
-
-	for (auto& axis : axes1) {
-		Vec proj1 = projectOnAxis(vertices1, axis);
-		Vec proj2 = projectOnAxis(vertices2, axis);
-
-		float overlap = getOverlapLength(proj1, proj2);
+bool Shape::SAT(Shape const& other) {
+	for (auto overlap : get_overlaps(*this, other)) {
 		if (overlap == 0.f) { // shapes are not overlapping
 			return false;
-		} else {
-			if (overlap < minOverlap) {
-				minOverlap = overlap;
-				t_mtv.x = axis.x * minOverlap;
-				t_mtv.y = axis.y * minOverlap;
-			}
 		}
 	}
-	for (auto& axis : axes2) {
-		Vec proj1 = projectOnAxis(vertices1, axis);
-		Vec proj2 = projectOnAxis(vertices2, axis);
+	return true;
+}
 
-		float overlap = getOverlapLength(proj1, proj2);
-		if (overlap == 0.f) { // shapes are not overlapping
-			return false;
-		} else {
-			if (overlap < minOverlap) {
-				minOverlap = overlap;
-				t_mtv.x = axis.x * minOverlap;
-				t_mtv.y = axis.y * minOverlap;
-				// ideally we would do this only once for the minimal overlap
-				// but this is very cheap operation
+Shape::Contact Shape::get_contact(Shape const& other) const {
+	std::array<float, 8> overlaps{};
+	if (is_axis_aligned() && other.is_axis_aligned()) {
+		// every axis is +-x or +-y, so the projections are just the bounds and each axis reuses one of two overlaps.
+		// negated axes mirror both ranges, which leaves the overlap length bit for bit unchanged.
+		auto bounds = [](Polygon const& vertices) {
+			std::array<float, 4> ret{std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity()};
+			for (auto const& vertex : vertices) {
+				ret[0] = std::min(ret[0], vertex.x);
+				ret[1] = std::max(ret[1], vertex.x);
+				ret[2] = std::min(ret[2], vertex.y);
+				ret[3] = std::max(ret[3], vertex.y);
 			}
-		}
+			return ret;
+		};
+		auto const first = bounds(vertices);
+		auto const second = bounds(other.vertices);
+		auto overlap = [](float min1, float max1, float min2, float max2) { return min1 <= max2 && max1 >= min2 ? std::min(max1, max2) - std::max(min1, min2) : 0.f; };
+		auto const x = overlap(first[0], first[1], second[0], second[1]);
+		auto const y = overlap(first[2], first[3], second[2], second[3]);
+		for (std::size_t i{0}; i < 8; ++i) { overlaps[i] = (i < 4 ? normals[i] : other.normals[i - 4]).x != 0.f ? x : y; }
+	} else {
+		overlaps = get_overlaps(*this, other);
+	}
+	return {get_mtv(*this, other, overlaps), std::find(overlaps.begin(), overlaps.end(), 0.f) == overlaps.end()};
+}
+
+bool Shape::is_axis_aligned() const {
+	if (normals.size() != 4) { return false; }
+	for (auto const& normal : normals) {
+		if (!(normal.x == 0.f && std::abs(normal.y) == 1.f) && !(normal.y == 0.f && std::abs(normal.x) == 1.f)) { return false; }
 	}
 	return true;
 }
@@ -333,6 +296,30 @@ bool Shape::overlaps(Shape const& other) const {
 	return ret;
 }
 
+// this shape is assumed to have just moved by displacement. returns the fraction of that move at which it first overlapped other.
+// touching is not overlapping: the mover is shrunk by sweep_skin on every side, so a body sliding flush along a floor or wall
+// doesn't hit the next tile at every seam, and a path that only grazes an edge or corner reports nothing.
+std::optional<float> Shape::sweep(Vec displacement, Shape const& other) const {
+	float enter{0.f};
+	float exit{1.f};
+	auto slab = [&enter, &exit](float min, float max, float other_min, float other_max, float delta) {
+		min += sweep_skin;
+		max -= sweep_skin;
+		if (delta == 0.f) {
+			if (min >= other_max || max <= other_min) { exit = -1.f; }
+			return;
+		}
+		auto first = (other_min - max) / delta;
+		auto second = (other_max - min) / delta;
+		enter = std::max(enter, std::min(first, second));
+		exit = std::min(exit, std::max(first, second));
+	};
+	slab(vertices.at(0).x - displacement.x, vertices.at(1).x - displacement.x, other.vertices.at(0).x, other.vertices.at(1).x, displacement.x);
+	slab(vertices.at(0).y - displacement.y, vertices.at(2).y - displacement.y, other.vertices.at(0).y, other.vertices.at(2).y, displacement.y);
+	if (enter >= exit) { return {}; }
+	return enter;
+}
+
 bool Shape::contains_point(Vec point) { 
 	bool ret{true};
 	if (vertices.at(0).x > point.x) { ret = false; }
@@ -8,16 +8,26 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <optional>
 #include <vector>
+#include "StaticVector.hpp"
 
 namespace shape {
 
 float const error = 0.0001f;
+float const sweep_skin = 0.1f; // how far a swept box must sink into another before it counts as a hit
 
 class Shape {
 
   public:
 	using Vec = sf::Vector2<float>;
+	using Polygon = util::StaticVector<Vec, 4>; // shapes are at most quads, so vertex data is stored inline
+
+	// result of SAT and testCollisionGetMTV against the same shape, computed in one pass
+	struct Contact {
+		Vec mtv{};
+		bool overlapping{};
+	};
 
 	Shape();
 	Shape(std::vector<Vec> verts, std::vector<Vec> edg);
@@ -35,18 +45,21 @@ class Shape {
 	Vec getNormalized(const Vec v);
 	float dotProduct(const Vec a, const Vec b);
 	Vec getNormal(const Vec v);
-	Vec projectOnAxis(const std::vector<Vec> vertices, const Vec axis);
+	Vec projectOnAxis(Polygon const& vertices, const Vec axis);
 	bool areOverlapping(Vec const& a, Vec const& b);
 	float getOverlapLength(Vec const& a, Vec const& b);
 	Vec getCenter(Shape const& shape);
 	Vec getThisCenter();
-	std::vector<Vec> getVertices(Shape const& shape);
-	Vec getPerpendicularAxis(const std::vector<Vec> vertices, std::size_t index);
-	std::array<Vec, 8> getPerpendicularAxes(const std::vector<Vec> vertices1, std::vector<Vec> const& vertices2);
+	Polygon const& getVertices(Shape const& shape);
+	Vec getPerpendicularAxis(Polygon const& vertices, std::size_t index);
+	std::array<Vec, 8> getPerpendicularAxes(Polygon const& vertices1, Polygon const& vertices2);
 	bool testCollision(Shape const& obb1, Shape const& obb2, Vec& mtv);
 	Vec testCollisionGetMTV(Shape const& obb1, Shape const& obb2);
 	bool SAT(Shape const& other);
+	Contact get_contact(Shape const& other) const;
+	bool is_axis_aligned() const;
 	bool overlaps(Shape const& other) const;
+	std::optional<float> sweep(Vec displacement, Shape const& other) const;
 	bool contains_point(Vec point);
 
 	[[nodiscard]] auto left() const -> float { return position.x; }
@@ -61,9 +74,9 @@ class Shape {
 	bool AABB_is_left_collision(Shape const& immovable);
 	bool AABB_is_right_collision(Shape const& immovable);
 
-	std::vector<Vec> vertices;
-	std::vector<Vec> edges;
-	std::vector<Vec> normals;
+	Polygon vertices;
+	Polygon edges;
+	Polygon normals;
 	Vec axis;
 
 	// for hurtboxes
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+namespace util {
+
+// vector-like container with a fixed inline capacity. nothing is ever heap allocated,
+// so objects holding one can be copied and iterated without touching the allocator.
+template <typename T, std::size_t N>
+class StaticVector {
+  public:
+	constexpr void push_back(T const& value) {
+		if (count == N) { throw std::length_error("StaticVector capacity exceeded"); }
+		storage[count++] = value;
+	}
+	constexpr void clear() { count = 0; }
+
+	[[nodiscard]] constexpr auto at(std::size_t index) -> T& { return index < count ? storage[index] : throw std::out_of_range("StaticVector index out of range"); }
+	[[nodiscard]] constexpr auto at(std::size_t index) const -> T const& { return index < count ? storage[index] : throw std::out_of_range("StaticVector index out of range"); }
+	[[nodiscard]] constexpr auto operator[](std::size_t index) -> T& { return storage[index]; }
+	[[nodiscard]] constexpr auto operator[](std::size_t index) const -> T const& { return storage[index]; }
+	[[nodiscard]] constexpr auto front() -> T& { return storage[0]; }
+	[[nodiscard]] constexpr auto front() const -> T const& { return storage[0]; }
+	[[nodiscard]] constexpr auto back() -> T& { return storage[count - 1]; }
+	[[nodiscard]] constexpr auto back() const -> T const& { return storage[count - 1]; }
+	[[nodiscard]] constexpr auto begin() { return storage.begin(); }
+	[[nodiscard]] constexpr auto begin() const { return storage.begin(); }
+	[[nodiscard]] constexpr auto end() { return storage.begin() + count; }
+	[[nodiscard]] constexpr auto end() const { return storage.begin() + count; }
+	[[nodiscard]] constexpr auto data() const -> T const* { return storage.data(); }
+	[[nodiscard]] constexpr auto size() const -> std::size_t { return count; }
+	[[nodiscard]] constexpr auto empty() const -> bool { return count == 0; }
+	[[nodiscard]] static constexpr auto capacity() -> std::size_t { return N; }
+
+  private:
+	std::array<T, N> storage{};
+	std::size_t count{};
+};
+
+} // namespace util
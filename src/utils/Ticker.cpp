@@ -29,6 +29,21 @@ void Ticker::calculate_fps() {
 	seconds_passed = Tim::zero();
 }
 
+void Ticker::record_tick_cost(Clk::duration cost) {
+	auto const ms = std::chrono::duration<float, std::milli>(cost).count();
+	tick_costs.push(ms);
+	budget.tick_cost = budget.tick_cost == 0.f ? ms : budget.tick_cost * 0.95f + ms * 0.05f;
+	budget.max_tick_cost = std::max(budget.max_tick_cost, ms);
+}
+
+void Ticker::settle_debt() {
+	++budget.capped_frames;
+	auto const owed = std::floor(accumulator / ft);
+	auto const kept = budget.policy == TickPolicy::catch_up ? std::min(owed, budget.max_debt) : 0.f;
+	budget.dropped_ticks += owed - kept;
+	accumulator -= ft * (owed - kept);
+}
+
 void Ticker::slow_down(int time) { slowdown.start(time); }
 
 void Ticker::freeze_frame(int time) { freezeframe.start(time); }
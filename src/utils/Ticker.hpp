@@ -1,7 +1,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <deque>
 #include <functional>
 #include <memory>
@@ -10,6 +12,7 @@
 #include <utility>
 #include "Cooldown.hpp"
 #include "BitFlags.hpp"
+#include "RingBuffer.hpp"
 
 namespace util {
 
@@ -18,6 +21,9 @@ using Tim = std::chrono::duration<float>;
 using Mil = std::chrono::milliseconds;
 
 enum class TickerFlags { forced_slowdown, paused };
+// what to do with simulation time a frame could not afford to tick.
+// slowdown drops it, so the game runs slower instead of stalling. catch_up carries it into later frames, up to max_debt ticks.
+enum class TickPolicy { slowdown, catch_up };
 
 class Ticker {
   public:
@@ -38,23 +44,33 @@ class Ticker {
 		dt *= dt_scalar;
 		current_time = new_time;
 
-		if (dt.count() > tick_limit.count()) { return; } // return for unexpected dt values, particularly during the beginning of the state
+		if (dt.count() > tick_limit.count()) { // return for unexpected dt values, particularly during the beginning of the state
+			++budget.skipped_frames;
+			return;
+		}
 
 		accumulator = dt + residue;
 		if (accumulator < ft) {
-			residue += accumulator;
+			residue = accumulator;
 			accumulator = Tim::zero();
 			return;
 		}
 
 		integrations = 0;
+		auto const frame_start = Clk::now();
 		while (accumulator >= ft) {
+			// stop once this frame's tick budget is spent, but always make progress
+			if (integrations >= budget.max_ticks || (integrations > 0 && Clk::now() - frame_start > budget.frame_budget)) { break; }
+			auto const tick_start = Clk::now();
 			if (!flags.test(TickerFlags::paused)) { fn(); }
+			record_tick_cost(Clk::now() - tick_start);
 			accumulator -= ft;
 			++integrations;
 			++total_integrations;
 			++ticks;
 		}
+		if (accumulator >= ft) { settle_debt(); }
+		budget.debt = std::floor(accumulator / ft);
 
 		residue = accumulator;
 		slowdown.update();
@@ -63,6 +79,17 @@ class Ticker {
 		++calls_per_frame;
 	};
 
+	// runs a single fixed tick immediately, ignoring wall-clock time. used to drive the simulation headlessly.
+	template <typename F>
+	void step(F fn) {
+		ft = Tim{tick_rate};
+		if (!flags.test(TickerFlags::paused)) { fn(); }
+		++total_integrations;
+		++ticks;
+		slowdown.update();
+		freezeframe.update();
+	}
+
 	void start_frame();
 	void end_frame();
 	void calculate_fps();
@@ -75,6 +102,9 @@ class Ticker {
 	[[nodiscard]] auto paused() const -> bool { return flags.test(TickerFlags::paused); }
 
 	[[nodiscard]] auto global_tick_rate() const -> float { return ft.count() * tick_multiplier; }
+	// how far the frame is between the last tick and the next one. renderers lerp between tick states by this.
+	// while paused no tick is coming, so frames hold the last state instead of swinging with the residue.
+	[[nodiscard]] auto get_alpha() const -> float { return ft.count() > 0.f && !paused() ? std::clamp(residue / ft, 0.f, 1.f) : 1.f; }
 	[[nodiscard]] auto every_x_frames(int const freq) const -> bool { return num_frames % freq == 0; }
 	[[nodiscard]] auto every_x_ticks(int const freq) const -> bool { return ticks % freq == 0; }
 	[[nodiscard]] auto every_x_milliseconds(int num_milliseconds) const -> bool { return (int)std::floor(total_milliseconds_passed.count()) % num_milliseconds == 0; } // doesn't work
@@ -102,6 +132,22 @@ class Ticker {
 	float total_integrations{};
 	float ticks_per_frame{};
 
+	// tick scheduling
+	struct {
+		TickPolicy policy{TickPolicy::slowdown};
+		int max_ticks{8};
+		Tim frame_budget{1.f / 60.f}; // wall-clock time the ticks of one frame may take
+		float max_debt{16.f}; // in ticks, for catch_up
+		// counters
+		float tick_cost{}; // moving average, in milliseconds
+		float max_tick_cost{};
+		float debt{}; // ticks owed going into the next frame
+		float dropped_ticks{};
+		int capped_frames{};
+		int skipped_frames{};
+	} budget{};
+	RingBuffer<float, 256> tick_costs{}; // milliseconds, most recent last
+
 	Tim seconds_passed{};
 	Tim total_seconds_passed{};
 	Tim in_game_seconds_passed{};
@@ -109,6 +155,9 @@ class Ticker {
 	float fps{60.f};
 
   private:
+	void record_tick_cost(Clk::duration cost);
+	void settle_debt();
+
 	std::deque<Tim> frame_list{};
 	BitFlags<TickerFlags> flags{};
 	float slowdown_rate{0.2f};
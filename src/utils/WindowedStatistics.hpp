@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace util {
+
+// streaming statistics over the last n samples. every push is O(1) amortized:
+// samples live in a fixed ring buffer, the windowed maximum is tracked with a monotonic queue
+// and the deltas between neighbours telescope, so their average (jerk, when fed accelerations) needs only the window's ends.
+// storage is only allocated once the window is enabled, so disabled instances are nearly free.
+class WindowedStatistics {
+  public:
+	WindowedStatistics() = default;
+	WindowedStatistics(std::size_t size) { enable(size); }
+
+	void enable(std::size_t size) {
+		samples.assign(size, 0.f);
+		maxima.assign(size, 0);
+		clear();
+	}
+	void disable() {
+		samples = {};
+		maxima = {};
+		clear();
+	}
+	void clear() {
+		head = 0;
+		count = 0;
+		max_head = 0;
+		max_count = 0;
+		total = 0;
+	}
+
+	void push(float sample) {
+		if (samples.empty()) { return; }
+		auto const capacity = samples.size();
+
+		// evict the oldest sample once the window is full
+		if (count == capacity) {
+			auto const oldest = total - capacity;
+			if (max_count > 0 && maxima[max_head] == oldest) {
+				max_head = (max_head + 1) % capacity;
+				--max_count;
+			}
+			head = (head + 1) % capacity;
+			--count;
+		}
+
+		samples[(head + count) % capacity] = sample;
+		++count;
+
+		// keep maxima strictly decreasing so the front is always the windowed max
+		while (max_count > 0 && at(maxima[(max_head + max_count - 1) % capacity]) <= sample) { --max_count; }
+		maxima[(max_head + max_count) % capacity] = total;
+		++max_count;
+		++total;
+	}
+
+	[[nodiscard]] auto enabled() const -> bool { return !samples.empty(); }
+	[[nodiscard]] auto size() const -> std::size_t { return count; }
+	[[nodiscard]] auto capacity() const -> std::size_t { return samples.size(); }
+	[[nodiscard]] auto oldest() const -> float { return count == 0 ? 0.f : samples[head]; }
+	[[nodiscard]] auto newest() const -> float { return count == 0 ? 0.f : samples[(head + count - 1) % samples.size()]; }
+	[[nodiscard]] auto maximum() const -> float { return max_count == 0 ? 0.f : at(maxima[max_head]); }
+	// computed from the samples themselves, so no rounding error piles up however long the window runs
+	[[nodiscard]] auto average_delta() const -> float { return samples.empty() ? 0.f : (newest() - oldest()) / static_cast<float>(samples.size()); }
+
+  private:
+	// samples are addressed by their absolute push index, which maps directly onto the ring
+	[[nodiscard]] auto at(std::size_t index) const -> float { return samples[index % samples.size()]; }
+
+	std::vector<float> samples{};
+	std::vector<std::size_t> maxima{};
+	std::size_t head{};
+	std::size_t count{};
+	std::size_t max_head{};
+	std::size_t max_count{};
+	std::size_t total{};
+};
+
+} // namespace util
@@ -42,7 +42,7 @@ void GrapplingHook::break_free(player::Player& player) {
 	player.controller.release_hook();
 }
 
-void GrapplingHook::render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win, sf::Vector2<float>& campos) {
+void GrapplingHook::render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win, sf::Vector2<float>& campos) {
 	if (svc.greyblock_mode()) {
 		spring.render(win, campos);
 	} else {
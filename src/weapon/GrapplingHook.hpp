@@ -4,6 +4,7 @@
 #include "../particle/Spring.hpp"
 #include "../utils/Cooldown.hpp"
 #include "../utils/Direction.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -22,7 +23,7 @@ class GrapplingHook {
 	GrapplingHook(automa::ServiceProvider& svc);
 	void update(automa::ServiceProvider& svc, player::Player& player);
 	void break_free(player::Player& player);
-	void render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win, sf::Vector2<float>& campos);
+	void render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win, sf::Vector2<float>& campos);
 
 	sf::Vector2<float> probe_velocity(float speed);
 	vfx::Spring spring{};
@@ -72,7 +72,7 @@ void Grenade::update(automa::ServiceProvider& svc, player::Player& player, world
 	drawbox.setPosition(physics.position);
 }
 
-void Grenade::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam) {
+void Grenade::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam) {
 	auto u = 0;
 	auto v = animation.get_frame() * sprite_dimensions.y;
 	sprite.setTextureRect(sf::IntRect({u, v}, {sprite_dimensions}));
@@ -7,6 +7,7 @@
 #include "../utils/Direction.hpp"
 #include "../entities/animation/Animation.hpp"
 #include "../components/CircleSensor.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -27,7 +28,7 @@ class Grenade : public shape::Collider, public entity::Entity {
   public:
 	Grenade(automa::ServiceProvider& svc, sf::Vector2<float> position, dir::Direction direction);
 	void update(automa::ServiceProvider& svc, player::Player& player, world::Map& map);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float> cam);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float> cam);
 	[[nodiscard]] auto detonated() const -> bool { return grenade_flags.test(GrenadeFlags::detonated); }
 	[[nodiscard]] auto get_damage() const -> float { return damage; }
 
@@ -162,7 +162,11 @@ void Projectile::update(automa::ServiceProvider& svc, player::Player& player) {
 	if (state.test(arms::ProjectileState::destroyed)) { --m_weapon->active_projectiles; }
 }
 
-void Projectile::render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win, sf::Vector2<float>& campos) {
+void Projectile::render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win, sf::Vector2<float>& campos) {
+	auto const alpha = svc.ticker.get_alpha();
+	// constrained sprites are cut from the hitbox, so they're shifted back along the last tick's travel instead of placed from a blend.
+	// once they hit something the cut is pinned to the destruction point and stays put.
+	auto const lag = stats.constrained && !state.test(ProjectileState::destruction_initiated) ? (physics.previous_position - physics.position) * (1.f - alpha) : sf::Vector2<float>{};
 
 	// this is the right idea but needs to be refactored and generalized
 	if (render_type == RENDER_TYPE::MULTI_SPRITE) {
@@ -171,6 +175,7 @@ void Projectile::render(automa::ServiceProvider& svc, player::Player& player, sf
 		sprite.setTextureRect(sf::IntRect({u, v}, {(int)max_dimensions.x, (int)max_dimensions.y}));
 		constrain_sprite_at_barrel(sprite, campos);
 		if (state.test(ProjectileState::destruction_initiated)) { constrain_sprite_at_destruction_point(sprite, campos); }
+		sprite.move(lag);
 		win.draw(sprite);
 
 		return;
@@ -181,7 +186,7 @@ void Projectile::render(automa::ServiceProvider& svc, player::Player& player, sf
 		sprite.setTextureRect(sf::IntRect({u, v}, {(int)max_dimensions.x, (int)max_dimensions.y}));
 
 		// unconstrained projectiles have to get sprites set here
-		if (stats.boomerang) { sprite.setPosition(gravitator.collider.physics.position - campos); }
+		if (stats.boomerang) { sprite.setPosition(gravitator.collider.get_interpolated_position(alpha) - campos); }
 		if (stats.spring) { hook.render(svc, player, win, campos); }
 		if (stats.spring && hook.grapple_flags.test(GrappleState::snaking)) {
 			sprite.setPosition(hook.spring.get_bob() - campos);
@@ -191,6 +196,7 @@ void Projectile::render(automa::ServiceProvider& svc, player::Player& player, sf
 
 		constrain_sprite_at_barrel(sprite, campos);
 		if (state.test(ProjectileState::destruction_initiated)) { constrain_sprite_at_destruction_point(sprite, campos); }
+		sprite.move(lag);
 
 		// proj bounding box for debug
 		box.setSize(bounding_box.dimensions);
@@ -255,7 +261,7 @@ void Projectile::set_sprite(automa::ServiceProvider& svc) {
 		return;
 	}
 	sprite.setTexture(svc.assets.projectile_textures.at(label));
-	sprite_index = svc.random.random_range(0, anim.num_sprites - 1);
+	sprite_index = svc.random.vfx.random_range(0, anim.num_sprites - 1);
 }
 
 void Projectile::set_orientation(sf::Sprite& sprite) {
@@ -276,6 +282,7 @@ void Projectile::set_orientation(sf::Sprite& sprite) {
 
 void Projectile::set_position(sf::Vector2<float> pos) {
 	physics.position = pos;
+	physics.previous_position = pos;
 	bounding_box.position = pos;
 	gravitator.set_position(pos);
 	fired_point = pos;
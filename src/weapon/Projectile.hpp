@@ -20,6 +20,7 @@
 #include "../utils/Random.hpp"
 #include "../utils/Shape.hpp"
 #include "GrapplingHook.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace automa {
 struct ServiceProvider;
@@ -108,7 +109,7 @@ class Projectile {
 	Projectile(automa::ServiceProvider& svc, std::string_view label, int id, Weapon& weapon);
 
 	void update(automa::ServiceProvider& svc, player::Player& player);
-	void render(automa::ServiceProvider& svc, player::Player& player, sf::RenderWindow& win, sf::Vector2<float>& campos);
+	void render(automa::ServiceProvider& svc, player::Player& player, flfx::DrawList& win, sf::Vector2<float>& campos);
 	void destroy(bool completely, bool whiffed = false);
 	void seed(automa::ServiceProvider& svc);
 	void set_sprite(automa::ServiceProvider& svc);
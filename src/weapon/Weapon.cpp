@@ -51,12 +51,12 @@ void Weapon::update(dir::Direction to_direction) {
 	}
 }
 
-void Weapon::render_back(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float>& campos) {
+void Weapon::render_back(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float>& campos) {
 	if (attributes.boomerang && active_projectiles == attributes.rate) { return; }
 	if (!svc.greyblock_mode()) { win.draw(sp_gun_back); }
 }
 
-void Weapon::render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float>& campos) {
+void Weapon::render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float>& campos) {
 
 	// nani threw it, so don't render it in her hand
 	if (attributes.boomerang && active_projectiles == attributes.rate) { return; }
@@ -7,6 +7,7 @@
 #include "../utils/BitFlags.hpp"
 #include "Projectile.hpp"
 #include "Ammo.hpp"
+#include "../graphics/DrawList.hpp"
 
 namespace arms {
 
@@ -32,8 +33,8 @@ class Weapon {
 	Weapon(automa::ServiceProvider& svc, std::string_view label, int id);
 
 	void update(dir::Direction to_direction);
-	void render_back(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float>& campos);
-	void render(automa::ServiceProvider& svc, sf::RenderWindow& win, sf::Vector2<float>& campos);
+	void render_back(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float>& campos);
+	void render(automa::ServiceProvider& svc, flfx::DrawList& win, sf::Vector2<float>& campos);
 
 	void equip();
 	void unequip();